@@ -5,7 +5,9 @@ import { TurboModuleRegistry } from 'react-native';
 
 const module = TurboModuleRegistry.get('WinRTTurboModule');
 if (module) {
-    module.initialize();
+    // Options can be provided by setting 'global.__rnwinrtOptions' before this module is imported, e.g.
+    // '{ projectionMode: "prototype", typedArrays: true }'
+    module.initialize(global.__rnwinrtOptions);
 }
 
 export default module;
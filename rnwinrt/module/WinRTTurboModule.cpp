@@ -12,13 +12,19 @@ using namespace rnwinrt;
 
 jsi::Value WinRTTurboModuleSpecJSI_initialize(
     jsi::Runtime& runtime, react::TurboModule& turboModule, const jsi::Value*, size_t);
+jsi::Value WinRTTurboModuleSpecJSI_getStatistics(
+    jsi::Runtime& runtime, react::TurboModule& turboModule, const jsi::Value*, size_t);
+jsi::Value WinRTTurboModuleSpecJSI_createStreamReader(
+    jsi::Runtime& runtime, react::TurboModule& turboModule, const jsi::Value*, size_t);
 
 thread_local runtime_context* current_thread_context = nullptr;
 
 WinRTTurboModule::WinRTTurboModule(std::shared_ptr<react::CallInvoker> invoker) :
     TurboModule("WinRTTurboModule", invoker), m_invoker(std::move(invoker))
 {
-    methodMap_["initialize"] = MethodMetadata{ 0, WinRTTurboModuleSpecJSI_initialize };
+    methodMap_["initialize"] = MethodMetadata{ 1, WinRTTurboModuleSpecJSI_initialize };
+    methodMap_["getStatistics"] = MethodMetadata{ 0, WinRTTurboModuleSpecJSI_getStatistics };
+    methodMap_["createStreamReader"] = MethodMetadata{ 2, WinRTTurboModuleSpecJSI_createStreamReader };
 
     APTTYPE type;
     APTTYPEQUALIFIER typeQualifier;
@@ -32,20 +38,107 @@ WinRTTurboModule::~WinRTTurboModule()
 {
     if (auto ptr = std::exchange(current_thread_context, nullptr))
     {
+        // The context may outlive the runtime (e.g. when reloading while async operations are outstanding), so release
+        // any cached JS values that are tied to the runtime now
+        ptr->builtins.clear();
+        ptr->function_cache.clear();
+        ptr->class_cache.clear();
         ptr->release();
     }
 }
 
 // Functions exposed to JS
-void WinRTTurboModule::initialize(jsi::Runtime& runtime)
+void WinRTTurboModule::initialize(jsi::Runtime& runtime, const jsi::Value& options)
 {
     if (!m_initialized)
     {
+        // Options are '{ projectionMode: "hostObject" | "prototype", typedArrays: boolean, buffersAsArrayBuffers:
+        // boolean, eventDelivery: "sync" | "async", progressThrottleMs: number, collectionChunkSize: number }'. See the
+        // 'projection_mode' enum, 'runtime_context::typed_arrays', 'runtime_context::buffers_as_array_buffers', the
+        // 'event_delivery' enum, 'runtime_context::progress_throttle', and 'runtime_context::collection_chunk_size'
+        // for details
+        auto mode = projection_mode::host_object;
+        bool typedArrays = false;
+        bool buffersAsArrayBuffers = false;
+        auto delivery = event_delivery::sync;
+        std::chrono::milliseconds progressThrottle{ 0 };
+        uint32_t chunkSize = 1024;
+        if (options.isObject())
+        {
+            auto optionsObj = options.getObject(runtime);
+            auto modeValue = optionsObj.getProperty(runtime, "projectionMode");
+            if (modeValue.isString())
+            {
+                auto modeName = modeValue.getString(runtime).utf8(runtime);
+                if (modeName == "prototype")
+                {
+                    mode = projection_mode::prototype;
+                }
+                else if (modeName != "hostObject")
+                {
+                    throw jsi::JSError(runtime, "TypeError: Unknown projectionMode '" + modeName + "'");
+                }
+            }
+
+            if (auto typedArraysValue = optionsObj.getProperty(runtime, "typedArrays"); typedArraysValue.isBool())
+            {
+                typedArrays = typedArraysValue.getBool();
+            }
+
+            if (auto buffersValue = optionsObj.getProperty(runtime, "buffersAsArrayBuffers"); buffersValue.isBool())
+            {
+                buffersAsArrayBuffers = buffersValue.getBool();
+            }
+
+            if (auto deliveryValue = optionsObj.getProperty(runtime, "eventDelivery"); deliveryValue.isString())
+            {
+                auto deliveryName = deliveryValue.getString(runtime).utf8(runtime);
+                if (deliveryName == "async")
+                {
+                    delivery = event_delivery::async;
+                }
+                else if (deliveryName != "sync")
+                {
+                    throw jsi::JSError(runtime, "TypeError: Unknown eventDelivery '" + deliveryName + "'");
+                }
+            }
+
+            auto throttleValue = optionsObj.getProperty(runtime, "progressThrottleMs");
+            if (!throttleValue.isUndefined())
+            {
+                if (!throttleValue.isNumber() || !(throttleValue.getNumber() >= 0))
+                {
+                    throw jsi::JSError(runtime, "TypeError: progressThrottleMs must be a non-negative number");
+                }
+
+                auto ms = std::min(throttleValue.getNumber(), static_cast<double>(UINT32_MAX));
+                progressThrottle = std::chrono::milliseconds(static_cast<int64_t>(ms));
+            }
+
+            auto chunkSizeValue = optionsObj.getProperty(runtime, "collectionChunkSize");
+            if (!chunkSizeValue.isUndefined())
+            {
+                if (!chunkSizeValue.isNumber() || !(chunkSizeValue.getNumber() >= 1))
+                {
+                    throw jsi::JSError(runtime, "TypeError: collectionChunkSize must be a positive number");
+                }
+
+                auto size = std::min(chunkSizeValue.getNumber(), static_cast<double>(UINT32_MAX));
+                chunkSize = static_cast<uint32_t>(size);
+            }
+        }
+
         m_initialized = true;
 
         assert(!current_thread_context);
         current_thread_context = new runtime_context(
             runtime, [invoker = m_invoker](std::function<void()> fn) { invoker->invokeAsync(std::move(fn)); });
+        current_thread_context->mode = mode;
+        current_thread_context->typed_arrays = typedArrays;
+        current_thread_context->buffers_as_array_buffers = buffersAsArrayBuffers;
+        current_thread_context->default_event_delivery = delivery;
+        current_thread_context->progress_throttle = progressThrottle;
+        current_thread_context->collection_chunk_size = chunkSize;
 
         auto global = runtime.global();
         for (auto data : root_namespaces)
@@ -55,6 +148,60 @@ void WinRTTurboModule::initialize(jsi::Runtime& runtime)
     }
 }
 
+jsi::Value WinRTTurboModule::getStatistics(jsi::Runtime& runtime)
+{
+    if (!current_thread_context)
+    {
+        return jsi::Value::undefined();
+    }
+
+    auto& stats = current_thread_context->statistics;
+    jsi::Object result(runtime);
+    result.setProperty(runtime, "memberLookups", static_cast<double>(stats.member_lookups));
+    result.setProperty(runtime, "memberTableHits", static_cast<double>(stats.member_table_hits));
+    result.setProperty(runtime, "queuedCallbacks", static_cast<double>(stats.queued_callbacks));
+    result.setProperty(runtime, "queueDrains", static_cast<double>(stats.queue_drains));
+    return jsi::Value(runtime, result);
+}
+
+jsi::Value WinRTTurboModule::createStreamReader(
+    jsi::Runtime& runtime, const jsi::Value& stream, const jsi::Value& options)
+{
+    if (!current_thread_context)
+    {
+        throw jsi::JSError(runtime, "Error: WinRTTurboModule has not been initialized");
+    }
+
+    // Options are '{ chunkSize: number, readAhead: number }'. The defaults favor throughput for file streams
+    std::uint32_t chunkSize = 64 * 1024;
+    std::uint32_t readAhead = 2;
+    if (options.isObject())
+    {
+        auto optionsObj = options.getObject(runtime);
+        auto readOption = [&](const char* name, std::uint32_t& value) {
+            auto optionValue = optionsObj.getProperty(runtime, name);
+            if (optionValue.isUndefined())
+            {
+                return;
+            }
+
+            auto number = optionValue.isNumber() ? optionValue.getNumber() : 0;
+            if (!(number >= 1) || (number > std::numeric_limits<std::uint32_t>::max()))
+            {
+                throw jsi::JSError(runtime, std::string("TypeError: '") + name + "' must be a positive number");
+            }
+
+            value = static_cast<std::uint32_t>(number);
+        };
+
+        readOption("chunkSize", chunkSize);
+        readOption("readAhead", readAhead);
+    }
+
+    return create_stream_reader(runtime,
+        convert_value_to_native<winrt::Windows::Storage::Streams::IInputStream>(runtime, stream), chunkSize, readAhead);
+}
+
 runtime_context* rnwinrt::current_runtime_context()
 {
     auto result = current_thread_context;
@@ -69,12 +216,27 @@ runtime_context* rnwinrt::current_runtime_context()
 }
 
 jsi::Value WinRTTurboModuleSpecJSI_initialize(
-    jsi::Runtime& runtime, react::TurboModule& turboModule, const jsi::Value*, size_t)
+    jsi::Runtime& runtime, react::TurboModule& turboModule, const jsi::Value* args, size_t count)
 {
-    static_cast<WinRTTurboModule*>(&turboModule)->initialize(runtime);
+    const jsi::Value undefinedValue;
+    static_cast<WinRTTurboModule*>(&turboModule)->initialize(runtime, (count > 0) ? args[0] : undefinedValue);
     return jsi::Value::undefined();
 }
 
+jsi::Value WinRTTurboModuleSpecJSI_getStatistics(
+    jsi::Runtime& runtime, react::TurboModule& turboModule, const jsi::Value*, size_t)
+{
+    return static_cast<WinRTTurboModule*>(&turboModule)->getStatistics(runtime);
+}
+
+jsi::Value WinRTTurboModuleSpecJSI_createStreamReader(
+    jsi::Runtime& runtime, react::TurboModule& turboModule, const jsi::Value* args, size_t count)
+{
+    const jsi::Value undefinedValue;
+    return static_cast<WinRTTurboModule*>(&turboModule)
+        ->createStreamReader(runtime, (count > 0) ? args[0] : undefinedValue, (count > 1) ? args[1] : undefinedValue);
+}
+
 std::shared_ptr<react::TurboModule> CreateWinRTTurboModule(
     const std::shared_ptr<facebook::react::CallInvoker>& jsInvoker)
 {
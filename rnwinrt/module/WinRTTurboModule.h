@@ -13,7 +13,10 @@ public:
     ~WinRTTurboModule();
 
     // Functions exposed to JS
-    void initialize(facebook::jsi::Runtime& runtime);
+    void initialize(facebook::jsi::Runtime& runtime, const facebook::jsi::Value& options);
+    facebook::jsi::Value getStatistics(facebook::jsi::Runtime& runtime);
+    facebook::jsi::Value createStreamReader(
+        facebook::jsi::Runtime& runtime, const facebook::jsi::Value& stream, const facebook::jsi::Value& options);
 
 private:
     bool m_initialized = false;
@@ -27,7 +27,6 @@ namespace std
     };
 }
 
-// NOTE: Must be kept in-sync with the copy in base.cpp
 inline int compare_guid(const GUID& lhs, const GUID& rhs)
 {
     // NOTE: This method of comparison needs to remain consistant with how we sort the static array
@@ -42,6 +41,16 @@ inline int compare_guid(const GUID& lhs, const GUID& rhs)
     return (diff == 0) ? 0 : (diff < 0) ? -1 : 1;
 }
 
+// Hash function used for the perfect hash table that's generated for 'global_interface_map'
+// NOTE: Must be kept in-sync with the copy in base.cpp
+inline std::uint32_t hash_guid(const GUID& value, std::uint32_t seed) noexcept
+{
+    auto ptr = reinterpret_cast<const std::uint64_t*>(&value);
+    auto hash = (ptr[0] ^ (seed * 0x9E3779B97F4A7C15ull)) * 0xBF58476D1CE4E5B9ull;
+    hash = (hash ^ (hash >> 31) ^ ptr[1]) * 0x94D049BB133111EBull;
+    return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+}
+
 struct function_signature
 {
     winmd::reader::MethodDef method_def;
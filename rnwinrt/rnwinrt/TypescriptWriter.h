@@ -291,15 +291,36 @@ public:
 
     void WriteSpecialPropertiesAndMethods(TextWriter& textWriter, winmd::reader::TypeDef const& type)
     {
-        if (type.TypeNamespace() == "Windows.Foundation.Collections" && type.TypeName() == "IMapView`2")
+        // NOTE: 'toArray' is declared once for all iterables. The elements of maps are copied as '[key, value]' arrays,
+        // hence the conditional type
+        if (type.TypeNamespace() == "Windows.Foundation.Collections" && type.TypeName() == "IIterable`1")
         {
             textWriter.Write("%", R"(
-        readonly [key: string]: any;)");
+        toArray(): T extends Windows.Foundation.Collections.IKeyValuePair<infer K, infer V> ? [K, V][] : T[];)");
+        }
+        else if (type.TypeNamespace() == "Windows.Foundation.Collections" && type.TypeName() == "IMapView`2")
+        {
+            textWriter.Write("%", R"(
+        readonly [key: string]: any;
+        toObject(): { [key: string]: V };
+        toMap(): Map<K, V>;)");
         }
         else if (type.TypeNamespace() == "Windows.Foundation.Collections" && type.TypeName() == "IMap`2")
         {
             textWriter.Write("%", R"(
-        [key: string]: any;)");
+        [key: string]: any;
+        toObject(): { [key: string]: V };
+        toMap(): Map<K, V>;)");
+        }
+        else if (type.TypeNamespace() == "Windows.Foundation.Collections" && type.TypeName() == "IObservableMap`2")
+        {
+            textWriter.Write("%", R"(
+        mirror(): { [key: string]: V };)");
+        }
+        else if (type.TypeNamespace() == "Windows.Foundation.Collections" && type.TypeName() == "IObservableVector`1")
+        {
+            textWriter.Write("%", R"(
+        mirror(): T[];)");
         }
         else if (type.TypeNamespace() == "Windows.Foundation.Collections" && type.TypeName() == "IVector`1")
         {
@@ -57,7 +57,7 @@ namespace rnwinrt
         }
 
         template <typename... Args>
-        void write_fmt_temp(std::string_view fmtString, Args&&... args)
+        std::string write_fmt_temp(std::string_view fmtString, Args&&... args)
         {
             assert(count_placeholders(fmtString) == sizeof...(args));
 
@@ -46,6 +46,105 @@ static void write_rnwinrt_projections_cpp_namespace_includes(rnwinrt::writer& wr
     }
 }
 
+struct interface_hash_table
+{
+    // One entry per bucket. Positive values are the seed to re-hash with; negative values encode the slot directly for
+    // buckets that only contain a single interface
+    std::vector<std::int32_t> seeds;
+    std::vector<interface_instance*> slots;
+};
+
+// Builds a minimal perfect hash over the interface IIDs using the "hash and displace" technique: interfaces are first
+// split into buckets using a seed of zero, and then, starting with the largest bucket, each bucket searches for a seed
+// that places all of its interfaces into unused slots. The runtime can then find an interface with two hashes and a
+// single GUID comparison
+static interface_hash_table build_interface_hash_table(const std::vector<interface_instance*>& interfaces)
+{
+    interface_hash_table result;
+    auto size = static_cast<std::uint32_t>(interfaces.size());
+    if (size == 0)
+    {
+        return result;
+    }
+
+    // An average of four interfaces per bucket keeps the seed search quick while keeping the seed table small
+    auto bucketCount = std::max<std::uint32_t>(1, size / 4);
+    std::vector<std::vector<interface_instance*>> buckets(bucketCount);
+    for (auto iface : interfaces)
+    {
+        buckets[hash_guid(iface->iid, 0) % bucketCount].push_back(iface);
+    }
+
+    std::vector<std::uint32_t> order(bucketCount);
+    for (std::uint32_t i = 0; i < bucketCount; ++i)
+    {
+        order[i] = i;
+    }
+
+    std::stable_sort(order.begin(), order.end(),
+        [&](std::uint32_t lhs, std::uint32_t rhs) { return buckets[lhs].size() > buckets[rhs].size(); });
+
+    result.seeds.resize(bucketCount, 0);
+    result.slots.resize(size, nullptr);
+
+    std::uint32_t nextFreeSlot = 0;
+    std::vector<std::uint32_t> bucketSlots;
+    for (auto index : order)
+    {
+        auto& bucket = buckets[index];
+        if (bucket.empty())
+        {
+            break; // Sorted by size, so all remaining buckets are empty
+        }
+
+        if (bucket.size() == 1)
+        {
+            while (result.slots[nextFreeSlot])
+            {
+                ++nextFreeSlot;
+            }
+
+            result.slots[nextFreeSlot] = bucket[0];
+            result.seeds[index] = -static_cast<std::int32_t>(nextFreeSlot) - 1;
+            continue;
+        }
+
+        for (std::int32_t seed = 1;; ++seed)
+        {
+            if (seed == std::numeric_limits<std::int32_t>::max())
+            {
+                throw std::runtime_error("Unable to generate a perfect hash for the set of interfaces");
+            }
+
+            bucketSlots.clear();
+            for (auto iface : bucket)
+            {
+                auto slot = hash_guid(iface->iid, static_cast<std::uint32_t>(seed)) % size;
+                auto collision = std::find(bucketSlots.begin(), bucketSlots.end(), slot) != bucketSlots.end();
+                if (result.slots[slot] || collision)
+                {
+                    break;
+                }
+
+                bucketSlots.push_back(slot);
+            }
+
+            if (bucketSlots.size() == bucket.size())
+            {
+                for (std::size_t i = 0; i < bucket.size(); ++i)
+                {
+                    result.slots[bucketSlots[i]] = bucket[i];
+                }
+
+                result.seeds[index] = seed;
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
 static void write_rnwinrt_projections_cpp_file(const Settings& settings, const projection_data& data)
 {
     rnwinrt::file_writer writer(settings.OutputFolder / "Projections.g.cpp");
@@ -77,10 +176,22 @@ namespace rnwinrt
 )^-^");
 
     // 'global_interface_map' definition
+    // NOTE: The interfaces are written in the order of their slot in the perfect hash table, so the slot can be used to
+    // index directly into the map
+    auto hashTable = build_interface_hash_table(data.interfaces);
+    if (hashTable.slots.empty())
+    {
+        writer.write(R"^-^(    constexpr const span<const std::pair<winrt::guid, const static_interface_data*>> global_interface_map{};
+    constexpr const span<const std::int32_t> global_interface_map_seeds{};
+}
+)^-^");
+        return;
+    }
+
     writer.write(
         R"^-^(    static constexpr const std::pair<winrt::guid, const static_interface_data*> global_interface_map_data[] = {)^-^");
 
-    for (auto iface : data.interfaces)
+    for (auto iface : hashTable.slots)
     {
         writer.write_fmt(
             "\n        { winrt::guid_of<winrt::%>(), &rnwinrt::interfaces::% },",
@@ -95,6 +206,19 @@ namespace rnwinrt
     };
 
     constexpr const span<const std::pair<winrt::guid, const static_interface_data*>> global_interface_map(global_interface_map_data);
+
+    static constexpr const std::int32_t global_interface_map_seeds_data[] = {)^-^");
+
+    for (std::size_t i = 0; i < hashTable.seeds.size(); ++i)
+    {
+        writer.write((i % 16) == 0 ? "\n        "sv : " "sv);
+        writer.write_fmt("%,", hashTable.seeds[i]);
+    }
+
+    writer.write(R"^-^(
+    };
+
+    constexpr const span<const std::int32_t> global_interface_map_seeds(global_interface_map_seeds_data);
 }
 )^-^");
 }
@@ -397,6 +521,95 @@ static void write_rnwinrt_native_out_params(rnwinrt::writer& writer, const funct
     }
 }
 
+// NOTE: Must be kept in-sync with the copy in base.h
+static std::uint32_t hash_name(std::string_view name) noexcept
+{
+    // 32-bit FNV-1a
+    std::uint32_t hash = 2166136261u;
+    for (auto ch : name)
+    {
+        hash = (hash ^ static_cast<std::uint8_t>(ch)) * 16777619u;
+    }
+
+    return hash;
+}
+
+// Name tables smaller than this are searched linearly at runtime, which is just as fast, so they don't get an index
+static constexpr std::size_t min_name_index_size = 8;
+
+// Writes the '<prefix>_hashes' and '<prefix>_buckets' arrays that make up a 'static_name_index' (see base.h) for the
+// given names and returns the expression used to reference them, or '{}' if no index is needed
+static std::string write_rnwinrt_name_index(
+    rnwinrt::writer& writer, std::string_view prefix, const std::vector<std::string>& names)
+{
+    if ((names.size() < min_name_index_size) || (names.size() >= std::numeric_limits<std::uint16_t>::max()))
+    {
+        return "{}";
+    }
+
+    // Power of two size with a load factor of at most 50% so that probe sequences stay short
+    std::size_t bucketCount = 1;
+    while (bucketCount < (names.size() * 2))
+    {
+        bucketCount <<= 1;
+    }
+
+    auto mask = bucketCount - 1;
+    std::vector<std::uint32_t> hashes;
+    std::vector<std::uint16_t> buckets(bucketCount, 0);
+    for (std::size_t i = 0; i < names.size(); ++i)
+    {
+        auto hash = hash_name(names[i]);
+        hashes.push_back(hash);
+
+        // NOTE: Names can repeat (e.g. function overloads), in which case only the first is indexed since callers expect
+        // to get back the first of N consecutive entries
+        for (auto pos = hash & mask;; pos = (pos + 1) & mask)
+        {
+            if (!buckets[pos])
+            {
+                buckets[pos] = static_cast<std::uint16_t>(i + 1);
+                break;
+            }
+            else if (names[buckets[pos] - 1] == names[i])
+            {
+                break;
+            }
+        }
+    }
+
+    writer.write_fmt("\n    static constexpr const std::uint32_t %_hashes[] = {", prefix);
+    for (std::size_t i = 0; i < hashes.size(); ++i)
+    {
+        char buffer[16];
+        std::snprintf(buffer, std::size(buffer), "0x%08X,", hashes[i]);
+        writer.write((i % 8) == 0 ? "\n        "sv : " "sv);
+        writer.write(std::string_view{ buffer });
+    }
+
+    writer.write_fmt("\n    };\n\n    static constexpr const std::uint16_t %_buckets[] = {", prefix);
+    for (std::size_t i = 0; i < buckets.size(); ++i)
+    {
+        writer.write((i % 16) == 0 ? "\n        "sv : " "sv);
+        writer.write_fmt("%,", buckets[i]);
+    }
+
+    writer.write("\n    };\n");
+
+    return writer.write_fmt_temp("{ %_hashes, %_buckets }", prefix, prefix);
+}
+
+static std::string make_member_indices(
+    const std::string& propertyIndex, const std::string& eventIndex, const std::string& functionIndex)
+{
+    if ((propertyIndex == "{}") && (eventIndex == "{}") && (functionIndex == "{}"))
+    {
+        return {};
+    }
+
+    return ", static_member_indices{ " + propertyIndex + ", " + eventIndex + ", " + functionIndex + " }";
+}
+
 static void write_rnwinrt_enum_projection_data(rnwinrt::writer& writer, const enum_projection_data& enumData)
 {
     writer.write_fmt(R"^-^(
@@ -405,6 +618,8 @@ namespace rnwinrt::enums::%
     static constexpr const static_enum_data::value_mapping mappings[] = {)^-^",
         rnwinrt::cpp_typename{ enumData.type_def });
 
+    std::vector<std::string> names;
+    std::vector<std::string> values;
     for (auto&& field : enumData.type_def.FieldList())
     {
         if (!field.Constant()) // Enums have a 'value__' data member we need to ignore
@@ -425,18 +640,22 @@ namespace rnwinrt::enums::%
             continue;
         }
 
+        names.push_back(writer.write_fmt_temp("%", rnwinrt::camel_case{ field.Name() }));
         writer.write_fmt(R"^-^(
         { "%"sv, %, "%"sv },)^-^",
-            rnwinrt::camel_case{ field.Name() }, fieldValueAsString, fieldValueAsString);
+            names.back(), fieldValueAsString, fieldValueAsString);
+        values.push_back(std::move(fieldValueAsString));
     }
 
-    writer.write_fmt(R"^-^(
-    };
+    writer.write("\n    };\n");
 
-    constexpr const static_enum_data data{ "%"sv, mappings };
+    auto nameIndex = write_rnwinrt_name_index(writer, "name"sv, names);
+    auto valueIndex = write_rnwinrt_name_index(writer, "value"sv, values);
+    writer.write_fmt(R"^-^(
+    constexpr const static_enum_data data{ "%"sv, mappings, %, % };
 }
 )^-^",
-        enumData.name);
+        enumData.name, nameIndex, valueIndex);
 }
 
 static void write_rnwinrt_class_projection_data(rnwinrt::writer& writer, const class_projection_data& classData)
@@ -446,6 +665,7 @@ namespace rnwinrt::classes::%
 {)^-^",
         rnwinrt::cpp_typename{ classData.type_def });
 
+    std::string propertyIndex = "{}", eventIndex = "{}", functionIndex = "{}";
     if (!classData.methods.properties.empty())
     {
         writer.write(R"^-^(
@@ -486,6 +706,14 @@ namespace rnwinrt::classes::%
         }
 
         writer.write("\n    };\n");
+
+        std::vector<std::string> names;
+        for (auto& data : classData.methods.properties)
+        {
+            names.push_back(writer.write_fmt_temp("%", rnwinrt::camel_case{ data.name }));
+        }
+
+        propertyIndex = write_rnwinrt_name_index(writer, "property"sv, names);
     }
 
     if (!classData.methods.events.empty())
@@ -510,6 +738,14 @@ namespace rnwinrt::classes::%
         }
 
         writer.write("\n    };\n");
+
+        std::vector<std::string> names;
+        for (auto& data : classData.methods.events)
+        {
+            names.push_back(writer.write_fmt_temp("%", rnwinrt::event_name{ data.name }));
+        }
+
+        eventIndex = write_rnwinrt_name_index(writer, "event"sv, names);
     }
 
     if (!classData.methods.functions.empty())
@@ -556,7 +792,7 @@ namespace rnwinrt::classes::%
                 else if (overload.method.has_return_value)
                 {
                     writer.write(R"^-^(
-                    return convert_native_to_value(runtime, result);)^-^");
+                    return convert_native_to_value(runtime, std::move(result));)^-^");
                 }
                 else
                 {
@@ -576,17 +812,27 @@ namespace rnwinrt::classes::%
         }
 
         writer.write("\n    };\n");
+
+        std::vector<std::string> names;
+        for (auto& data : classData.methods.functions)
+        {
+            names.push_back(writer.write_fmt_temp("%", rnwinrt::camel_case{ data.name }));
+        }
+
+        functionIndex = write_rnwinrt_name_index(writer, "function"sv, names);
     }
 
+    auto memberIndices = make_member_indices(propertyIndex, eventIndex, functionIndex);
+
     if (classData.methods.constructors.empty())
     {
         writer.write_fmt(R"^-^(
-    constexpr const static_class_data data{ "%"sv, %, %, % };
+    constexpr const static_class_data data{ "%"sv, %, %, %% };
 }
 )^-^",
             classData.name, classData.methods.properties.empty() ? "{}"sv : "property_data"sv,
             classData.methods.events.empty() ? "{}"sv : "event_data"sv,
-            classData.methods.functions.empty() ? "{}"sv : "function_data"sv);
+            classData.methods.functions.empty() ? "{}"sv : "function_data"sv, memberIndices);
     }
     else
     {
@@ -626,13 +872,13 @@ namespace rnwinrt::classes::%
         throw_no_constructor(runtime, "%"sv, "%"sv, count);
     }
 
-    constexpr const static_activatable_class_data data{ "%"sv, "%"sv, constructor_function, %, %, % };
+    constexpr const static_activatable_class_data data{ "%"sv, "%"sv, constructor_function, %, %, %% };
 }
 )^-^",
             classData.type_def.TypeNamespace(), classData.type_def.TypeName(), classData.type_def.TypeNamespace(),
             classData.name, classData.methods.properties.empty() ? "{}"sv : "property_data"sv,
             classData.methods.events.empty() ? "{}"sv : "event_data"sv,
-            classData.methods.functions.empty() ? "{}"sv : "function_data"sv);
+            classData.methods.functions.empty() ? "{}"sv : "function_data"sv, memberIndices);
     }
 }
 
@@ -643,6 +889,7 @@ namespace rnwinrt::interfaces::%
 {)^-^",
         rnwinrt::cpp_typename{ ifaceData.type_def });
 
+    std::string propertyIndex = "{}", eventIndex = "{}", functionIndex = "{}";
     if (!ifaceData.methods.properties.empty())
     {
         writer.write(R"^-^(
@@ -657,8 +904,8 @@ namespace rnwinrt::interfaces::%
             if (data.getter)
             {
                 writer.write_fmt(R"^-^(
-            [](jsi::Runtime& runtime, const winrt::Windows::Foundation::IInspectable& thisValue) {
-                return convert_native_to_value(runtime, thisValue.as<winrt::%>().%());
+            [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                return convert_native_to_value(runtime, interface_cast<winrt::%>(thisValue).%());
             },)^-^",
                     rnwinrt::cpp_typename{ ifaceData.type_def }, data.name);
             }
@@ -670,8 +917,8 @@ namespace rnwinrt::interfaces::%
             if (data.setter)
             {
                 writer.write_fmt(R"^-^(
-            [](jsi::Runtime& runtime, const winrt::Windows::Foundation::IInspectable& thisValue, const jsi::Value& value) {
-                thisValue.as<winrt::%>().%(convert_value_to_native<%>(runtime, value));
+            [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value& value) {
+                interface_cast<winrt::%>(thisValue).%(convert_value_to_native<%>(runtime, value));
             },)^-^",
                     rnwinrt::cpp_typename{ ifaceData.type_def }, data.name,
                     [&](rnwinrt::writer& w) { rnwinrt::write_cppwinrt_type(w, data.setter->params().first); });
@@ -685,7 +932,15 @@ namespace rnwinrt::interfaces::%
         },)^-^");
         }
 
-        writer.write("\n    };");
+        writer.write("\n    };\n");
+
+        std::vector<std::string> names;
+        for (auto& data : ifaceData.methods.properties)
+        {
+            names.push_back(writer.write_fmt_temp("%", rnwinrt::camel_case{ data.name }));
+        }
+
+        propertyIndex = write_rnwinrt_name_index(writer, "property"sv, names);
     }
 
     if (!ifaceData.methods.events.empty())
@@ -697,11 +952,11 @@ namespace rnwinrt::interfaces::%
         {
             writer.write_fmt(R"^-^(
         { "%",
-            [](jsi::Runtime& runtime, const winrt::Windows::Foundation::IInspectable& thisValue, const jsi::Value& callback) {
-                return thisValue.as<winrt::%>().%(convert_value_to_native<%>(runtime, callback));
+            [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value& callback) {
+                return interface_cast<winrt::%>(thisValue).%(convert_value_to_native<%>(runtime, callback));
             },
-            [](const winrt::Windows::Foundation::IInspectable& thisValue, winrt::event_token token) {
-                thisValue.as<winrt::%>().%(token);
+            [](const queried_interface& thisValue, winrt::event_token token) {
+                interface_cast<winrt::%>(thisValue).%(token);
             }
         },)^-^",
                 rnwinrt::event_name{ data.name }, rnwinrt::cpp_typename{ ifaceData.type_def }, data.name,
@@ -710,6 +965,14 @@ namespace rnwinrt::interfaces::%
         }
 
         writer.write("\n    };\n");
+
+        std::vector<std::string> names;
+        for (auto& data : ifaceData.methods.events)
+        {
+            names.push_back(writer.write_fmt_temp("%", rnwinrt::event_name{ data.name }));
+        }
+
+        eventIndex = write_rnwinrt_name_index(writer, "event"sv, names);
     }
 
     if (!ifaceData.methods.functions.empty())
@@ -723,13 +986,13 @@ namespace rnwinrt::interfaces::%
             {
                 writer.write_fmt(R"^-^(
         { "%",
-            []([[maybe_unused]] jsi::Runtime& runtime, const winrt::Windows::Foundation::IInspectable& thisValue, [[maybe_unused]] const jsi::Value* args) {)^-^",
+            []([[maybe_unused]] jsi::Runtime& runtime, const queried_interface& thisValue, [[maybe_unused]] const jsi::Value* args) {)^-^",
                     rnwinrt::camel_case{ data.name });
 
                 write_rnwinrt_params_value_to_native(writer, overload.method, 5);
 
                 writer.write_fmt(R"^-^(
-                    %thisValue.as<winrt::%>().%()^-^",
+                    %interface_cast<winrt::%>(thisValue).%()^-^",
                     overload.method.has_return_value ? "auto result = " : "",
                     rnwinrt::cpp_typename{ ifaceData.type_def }, data.name);
 
@@ -751,7 +1014,7 @@ namespace rnwinrt::interfaces::%
                 else if (overload.method.has_return_value)
                 {
                     writer.write(R"^-^(
-                    return convert_native_to_value(runtime, result);)^-^");
+                    return convert_native_to_value(runtime, std::move(result));)^-^");
                 }
                 else
                 {
@@ -767,15 +1030,27 @@ namespace rnwinrt::interfaces::%
         }
 
         writer.write("\n    };\n");
+
+        // NOTE: Each overload has its own entry in the function table
+        std::vector<std::string> names;
+        for (auto& data : ifaceData.methods.functions)
+        {
+            auto name = writer.write_fmt_temp("%", rnwinrt::camel_case{ data.name });
+            names.insert(names.end(), data.overloads.size(), name);
+        }
+
+        functionIndex = write_rnwinrt_name_index(writer, "function"sv, names);
     }
 
+    auto memberIndices = make_member_indices(propertyIndex, eventIndex, functionIndex);
     writer.write_fmt(R"^-^(
-    constexpr const static_interface_data data{ winrt::guid_of<winrt::%>(), %, %, % };
+    constexpr const static_interface_data data{ winrt::guid_of<winrt::%>(), %, %, %% };
 }
 )^-^",
         rnwinrt::cpp_typename{ ifaceData.type_def }, ifaceData.methods.properties.empty() ? "{}"sv : "property_data"sv,
         ifaceData.methods.events.empty() ? "{}"sv : "event_data"sv,
-        ifaceData.methods.functions.empty() ? "{}"sv : "function_data"sv);
+        ifaceData.methods.functions.empty() ? "{}"sv : "function_data"sv,
+        memberIndices.empty() ? std::string{} : ", nullptr, nullptr" + memberIndices);
 }
 
 static void write_rnwinrt_namespace_cpp_files(const Settings& settings, const namespace_projection_data& ns)
@@ -813,6 +1088,7 @@ namespace rnwinrt::namespaces::%
 {)^-^",
         rnwinrt::cpp_namespace{ &ns });
 
+    std::string childrenIndex = "{}";
     if (!ns.named_children.empty())
     {
         writer.write(R"^-^(
@@ -840,13 +1116,21 @@ namespace rnwinrt::namespaces::%
         }
 
         writer.write("    };\n");
+
+        std::vector<std::string> names;
+        for (auto child : ns.named_children)
+        {
+            names.emplace_back(child->name);
+        }
+
+        childrenIndex = write_rnwinrt_name_index(writer, "children"sv, names);
     }
 
     writer.write_fmt(R"^-^(
-    constexpr const static_namespace_data data{ "%"sv, % };
+    constexpr const static_namespace_data data{ "%"sv, %, % };
 }
 )^-^",
-        ns.name, ns.named_children.empty() ? "{}" : "children");
+        ns.name, ns.named_children.empty() ? "{}" : "children", childrenIndex);
 
     // Static enum data
     for (auto& enumData : ns.enum_children)
@@ -950,7 +1234,7 @@ namespace rnwinrt::namespaces::%
             }
             else if (fn.has_return_value)
             {
-                writer.write("\n                return convert_native_to_value(runtime, result);");
+                writer.write("\n                return convert_native_to_value(runtime, std::move(result));");
             }
             else
             {
@@ -962,10 +1246,45 @@ namespace rnwinrt::namespaces::%
     }
 
     winrt::% projected_value_traits<winrt::%>::as_native(jsi::Runtime& runtime, const jsi::Value& value)
-    {
+    {)^-^",
+                rnwinrt::cpp_typename{ delegateData->type_def }, rnwinrt::cpp_typename{ delegateData->type_def });
+
+            // Delegates whose invocation doesn't produce anything that the caller needs back can be delivered
+            // asynchronously. Array params are excluded since they are views over memory owned by the caller
+            auto supportsAsync = !fn.has_return_value && !fn.has_out_params;
+            for (auto&& param : fn.params())
+            {
+                if (!param.is_input() || param.type().is_szarray())
+                {
+                    supportsAsync = false;
+                }
+            }
+
+            if (supportsAsync)
+            {
+                writer.write_fmt(R"^-^(
+        if (auto fn = async_delegate_function::create(runtime, value))
+        {
+            return [fn = std::move(fn)](%) {
+                fn->invoke()^-^",
+                    [&](rnwinrt::writer& w) { write_rnwinrt_native_function_params(w, fn); });
+
+                std::string_view paramPrefix;
+                for (int i = 0; i < fn.native_param_count(); ++i)
+                {
+                    writer.write_fmt("%param%", paramPrefix, i);
+                    paramPrefix = ", ";
+                }
+
+                writer.write(R"^-^();
+            };
+        }
+)^-^");
+            }
+
+            writer.write_fmt(R"^-^(
         return [ctxt = current_runtime_context()->add_reference(),
                    fn = value.asObject(runtime).asFunction(runtime)](%) {)^-^",
-                rnwinrt::cpp_typename{ delegateData->type_def }, rnwinrt::cpp_typename{ delegateData->type_def },
                 [&](rnwinrt::writer& w) { write_rnwinrt_native_function_params(w, fn); });
 
             auto writeReturnType = [&](rnwinrt::writer& w) {
@@ -6,8 +6,18 @@
 #include <Windows.h>
 
 #include <combaseapi.h>
+#include <deque>
+#include <inspectable.h>
+#include <robuffer.h>
+#include <unordered_set>
 #include <winstring.h>
 
+#if defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#elif defined(_M_ARM64)
+#include <arm64_neon.h>
+#endif
+
 using namespace rnwinrt;
 using namespace std::literals;
 
@@ -17,41 +27,154 @@ namespace winrt
     using namespace Windows::Foundation::Numerics;
 }
 
-jsi::String rnwinrt::make_string(jsi::Runtime& runtime, std::wstring_view str)
+// Most strings that cross the JS/WinRT boundary are ASCII (identifiers, paths, JSON, etc.), for which converting
+// between UTF-8 and UTF-16 is a simple widen/narrow of each character. These functions do that conversion 16 characters
+// at a time and stop as soon as they encounter a non-ASCII character, in which case the caller falls back to a full
+// conversion. 'widen_ascii_prefix' returns the number of characters it converted, which lets the caller continue after
+// the ASCII prefix. 'dest' must be at least 'length' characters
+static size_t widen_ascii_prefix(const char* src, size_t length, wchar_t* dest) noexcept
 {
-    if (str.empty())
+    size_t i = 0;
+#if defined(_M_X64) || defined(_M_IX86)
+    const auto zero = _mm_setzero_si128();
+    for (; (i + 16) <= length; i += 16)
     {
-        return jsi::String::createFromAscii(runtime, "");
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        if (_mm_movemask_epi8(chunk) != 0)
+        {
+            break;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_unpacklo_epi8(chunk, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i + 8), _mm_unpackhi_epi8(chunk, zero));
     }
+#elif defined(_M_ARM64)
+    for (; (i + 16) <= length; i += 16)
+    {
+        auto chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(src + i));
+        if (vmaxvq_u8(chunk) >= 0x80)
+        {
+            break;
+        }
 
-    auto bytes = ::WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, str.data(), static_cast<int32_t>(str.size()),
-        nullptr /*lpMultiByteStr*/, 0 /*cbMultiByte*/, nullptr /*lpDefaultChar*/, nullptr /*lpUsedDefaultChar*/);
-    winrt::check_bool(bytes);
+        vst1q_u16(reinterpret_cast<uint16_t*>(dest + i), vmovl_u8(vget_low_u8(chunk)));
+        vst1q_u16(reinterpret_cast<uint16_t*>(dest + i + 8), vmovl_u8(vget_high_u8(chunk)));
+    }
+#endif
+
+    for (; i < length; ++i)
+    {
+        auto ch = static_cast<unsigned char>(src[i]);
+        if (ch >= 0x80)
+        {
+            break;
+        }
 
-    auto buffer = std::make_unique<char[]>(bytes);
-    winrt::check_bool(::WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, str.data(), static_cast<int32_t>(str.size()),
-        buffer.get(), bytes, nullptr /*lpDefaultChar*/, nullptr /*lpUsedDefaultChar*/));
+        dest[i] = static_cast<wchar_t>(ch);
+    }
 
-    return jsi::String::createFromUtf8(runtime, reinterpret_cast<const uint8_t*>(buffer.get()), bytes);
+    return i;
 }
 
-std::u16string rnwinrt::string_to_utf16(jsi::Runtime& runtime, const jsi::String& string)
+static bool try_narrow_ascii(const wchar_t* src, size_t length, char* dest) noexcept
 {
-    auto str = string.utf8(runtime);
-    if (str.empty())
+    size_t i = 0;
+#if defined(_M_X64) || defined(_M_IX86)
+    const auto nonAsciiMask = _mm_set1_epi16(static_cast<short>(0xFF80));
+    const auto zero = _mm_setzero_si128();
+    for (; (i + 16) <= length; i += 16)
     {
-        return {};
+        auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+        auto nonAscii = _mm_and_si128(_mm_or_si128(low, high), nonAsciiMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(nonAscii, zero)) != 0xFFFF)
+        {
+            return false;
+        }
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), _mm_packus_epi16(low, high));
+    }
+#elif defined(_M_ARM64)
+    for (; (i + 16) <= length; i += 16)
+    {
+        auto low = vld1q_u16(reinterpret_cast<const uint16_t*>(src + i));
+        auto high = vld1q_u16(reinterpret_cast<const uint16_t*>(src + i + 8));
+        if (vmaxvq_u16(vorrq_u16(low, high)) >= 0x80)
+        {
+            return false;
+        }
+
+        vst1q_u8(reinterpret_cast<uint8_t*>(dest + i), vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+    }
+#endif
+
+    for (; i < length; ++i)
+    {
+        if (src[i] >= 0x80)
+        {
+            return false;
+        }
+
+        dest[i] = static_cast<char>(src[i]);
+    }
+
+    return true;
+}
+
+// NOTE: A UTF-8 string never has fewer bytes than its UTF-16 equivalent has code units, and a UTF-16 code unit never
+// needs more than three bytes in UTF-8, so these only need a single conversion pass into a buffer sized for the worst
+// case rather than the two passes needed to first calculate the exact size
+static size_t utf8_to_utf16(std::string_view str, wchar_t* dest)
+{
+    auto ascii = widen_ascii_prefix(str.data(), str.size(), dest);
+    if (ascii == str.size())
+    {
+        return ascii;
     }
 
-    auto len = ::MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, str.c_str(), static_cast<int32_t>(str.size()),
-        nullptr /*lpWideCharStr*/, 0 /*cchWideChar*/);
+    auto remaining = static_cast<int32_t>(str.size() - ascii);
+    auto len =
+        ::MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, str.data() + ascii, remaining, dest + ascii, remaining);
     winrt::check_bool(len);
+    return ascii + static_cast<size_t>(len);
+}
+
+jsi::String rnwinrt::make_string(jsi::Runtime& runtime, std::wstring_view str)
+{
+    if (str.empty())
+    {
+        return jsi::String::createFromAscii(runtime, "");
+    }
 
-    std::u16string result(len, 0);
-    winrt::check_bool(::MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, str.c_str(),
-        static_cast<int32_t>(str.size()), reinterpret_cast<LPWSTR>(result.data()), len));
+#if RNWINRT_JSI_HAS_UTF16
+    return jsi::String::createFromUtf16(runtime, reinterpret_cast<const char16_t*>(str.data()), str.size());
+#else
+    sso_vector<char, 512> buffer;
+    buffer.resize(str.size());
+    if (try_narrow_ascii(str.data(), str.size(), buffer.data()))
+    {
+        return jsi::String::createFromAscii(runtime, buffer.data(), str.size());
+    }
+
+    buffer.resize(str.size() * 3);
+    auto bytes = ::WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, str.data(), static_cast<int32_t>(str.size()),
+        buffer.data(), static_cast<int32_t>(buffer.size()), nullptr /*lpDefaultChar*/, nullptr /*lpUsedDefaultChar*/);
+    winrt::check_bool(bytes);
+
+    return jsi::String::createFromUtf8(runtime, reinterpret_cast<const uint8_t*>(buffer.data()), bytes);
+#endif
+}
 
+std::u16string rnwinrt::string_to_utf16(jsi::Runtime& runtime, const jsi::String& string)
+{
+#if RNWINRT_JSI_HAS_UTF16
+    return string.utf16(runtime);
+#else
+    auto str = string.utf8(runtime);
+    std::u16string result(str.size(), 0);
+    result.resize(utf8_to_utf16(str, reinterpret_cast<wchar_t*>(result.data())));
     return result;
+#endif
 }
 
 [[noreturn]] __declspec(noinline) void rnwinrt::throw_no_constructor(
@@ -88,266 +211,1115 @@ std::u16string rnwinrt::string_to_utf16(jsi::Runtime& runtime, const jsi::String
     throw jsi::JSError(runtime, std::move(msg));
 }
 
-// NOTE: Most lists are sorted, so in theory this could be a binary search-turns to linear search. The only thing
-// blocking this are enums, where their values are not currently sorted by name. Note however, that if this happens,
-// there can still be duplicates in a list (e.g. function overloads), so this would have to act more like
-// std::lower_bound (or std::equal_range) since callers expect the result to be the first.
-template <typename ThingWithName>
-static auto find_by_name(span<const ThingWithName* const> list, std::string_view name) noexcept
+template <typename T, typename Func>
+static const T& get_builtin(std::optional<T>& value, Func&& lookup)
 {
-    return std::find_if(list.begin(), list.end(), [&](const ThingWithName* ptr) { return ptr->name == name; });
+    if (!value)
+    {
+        value = lookup();
+    }
+
+    return *value;
 }
 
-template <typename ThingWithName>
-static auto find_by_name(span<const ThingWithName> list, std::string_view name) noexcept
+const jsi::Function& builtin_cache::date(jsi::Runtime& runtime)
 {
-    return std::find_if(list.begin(), list.end(), [&](const ThingWithName& thing) { return thing.name == name; });
+    return get_builtin(m_date, [&] { return runtime.global().getPropertyAsFunction(runtime, "Date"); });
 }
 
-jsi::Value object_instance_cache::get_instance(jsi::Runtime& runtime, const winrt::IInspectable& value)
+const jsi::Function& builtin_cache::promise(jsi::Runtime& runtime)
 {
-    if ((std::chrono::steady_clock::now() - last_cleanup) >= cleanup_interval)
-    {
-        cleanup(runtime);
-    }
-
-    // NOTE: Each interface has its own associated v-table, so two IInspectable pointers to the same object may actually
-    // be different if they were originally pointers to two different interfaces. Hence the QI here
-    auto instance = value.as<winrt::IInspectable>();
-    auto key = winrt::get_abi(instance);
-    if (auto itr = instances.find(key); itr != instances.end())
-    {
-        // NOTE: It is possible for an interface to get deallocated and have its memory address reused for a new object,
-        // however because we hold strong references to WinRT objects and weak references to the JS objects we create,
-        // this would imply that the JS object also got GC'd and would fail to resolve below
-        if (supports_weak_object)
-        {
-            if (auto strongValue = std::get<0>(itr->second).lock(runtime); !strongValue.isUndefined())
-            {
-                return strongValue;
-            }
-        }
-        else
-        {
-            if (auto hostObj = std::get<1>(itr->second).lock())
-            {
-                return jsi::Value(runtime, jsi::Object::createFromHostObject(runtime, std::move(hostObj)));
-            }
-        }
-
-        // Otherwise, the object has been GC'd. Remove it so that we can re-create the object below
-        instances.erase(itr);
-    }
-
-    auto hostObj = std::make_shared<projected_object_instance>(instance);
-    auto obj = jsi::Object::createFromHostObject(runtime, hostObj);
-    if (supports_weak_object)
-    {
-        try
-        {
-            instances.emplace(key, jsi::WeakObject(runtime, obj));
-        }
-        catch (std::logic_error&)
-        {
-            supports_weak_object = false;
-        }
-    }
-
-    if (!supports_weak_object)
-    {
-        instances.emplace(key, std::move(hostObj));
-    }
-
-    return jsi::Value(runtime, std::move(obj));
+    return get_builtin(m_promise, [&] { return runtime.global().getPropertyAsFunction(runtime, "Promise"); });
 }
 
-jsi::Value static_namespace_data::create(jsi::Runtime& runtime) const
+const jsi::Function& builtin_cache::promise_then(jsi::Runtime& runtime)
 {
-    return jsi::Value(runtime, jsi::Object::createFromHostObject(runtime, std::make_shared<projected_namespace>(this)));
+    return get_builtin(m_promiseThen, [&] {
+        return promise(runtime).getPropertyAsObject(runtime, "prototype").getPropertyAsFunction(runtime, "then");
+    });
 }
 
-jsi::Value projected_namespace::get(jsi::Runtime& runtime, const jsi::PropNameID& name)
+const jsi::Function& builtin_cache::promise_finally(jsi::Runtime& runtime)
 {
-    if (auto itr = find_by_name(m_data->children, name.utf8(runtime)); itr != m_data->children.end())
-    {
-        auto& item = m_children[itr - m_data->children.begin()];
-        if (item.isUndefined())
-        {
-            item = (*itr)->create(runtime);
-        }
-
-        return jsi::Value(runtime, item);
-    }
-
-    return jsi::Value::undefined();
+    return get_builtin(m_promiseFinally, [&] {
+        return promise(runtime).getPropertyAsObject(runtime, "prototype").getPropertyAsFunction(runtime, "finally");
+    });
 }
 
-void projected_namespace::set(jsi::Runtime& runtime, const jsi::PropNameID& name, const jsi::Value&)
+const jsi::Object& builtin_cache::array_prototype(jsi::Runtime& runtime)
 {
-    throw jsi::JSError(
-        runtime, "TypeError: Cannot assign to property '" + name.utf8(runtime) + "' of a projected WinRT namespace");
+    return get_builtin(m_arrayPrototype, [&] {
+        return runtime.global().getPropertyAsObject(runtime, "Array").getPropertyAsObject(runtime, "prototype");
+    });
 }
 
-std::vector<jsi::PropNameID> projected_namespace::getPropertyNames(jsi::Runtime& runtime)
+const jsi::Function& builtin_cache::array_push(jsi::Runtime& runtime)
 {
-    std::vector<jsi::PropNameID> result;
-    result.reserve(m_children.size());
-    for (auto ptr : m_data->children)
-    {
-        result.push_back(make_propid(runtime, ptr->name));
-    }
+    return get_builtin(m_arrayPush, [&] { return array_prototype(runtime).getPropertyAsFunction(runtime, "push"); });
+}
 
-    return result;
+const jsi::Function& builtin_cache::array_splice(jsi::Runtime& runtime)
+{
+    return get_builtin(
+        m_arraySplice, [&] { return array_prototype(runtime).getPropertyAsFunction(runtime, "splice"); });
 }
 
-jsi::Value static_enum_data::create(jsi::Runtime& runtime) const
+const jsi::Function& builtin_cache::array_pop(jsi::Runtime& runtime)
 {
-    return jsi::Value(runtime, jsi::Object::createFromHostObject(runtime, std::make_shared<projected_enum>(this)));
+    return get_builtin(m_arrayPop, [&] { return array_prototype(runtime).getPropertyAsFunction(runtime, "pop"); });
 }
 
-jsi::Value static_enum_data::get_value(jsi::Runtime& runtime, std::string_view valueName) const
+const jsi::Function& builtin_cache::array_from(jsi::Runtime& runtime)
 {
-    // TODO: It would also be rather simple to ensure that the array is sorted and do a binary search, however the
-    // number of enum elements is typically pretty small, so that may actually be harmful
-    auto itr = std::find_if(values.begin(), values.end(), [&](auto& mapping) { return mapping.name == valueName; });
-    if (itr != values.end())
-    {
-        return jsi::Value(itr->value);
-    }
+    return get_builtin(m_arrayFrom, [&] {
+        return runtime.global().getPropertyAsObject(runtime, "Array").getPropertyAsFunction(runtime, "from");
+    });
+}
 
-    // Look for a matching value (reverse mapping)
-    itr = std::find_if(values.begin(), values.end(), [&](auto& mapping) { return mapping.value_as_string == valueName; });
-    if (itr != values.end())
-    {
-        return jsi::Value(runtime, make_string(runtime, itr->name));
-    }
+const jsi::Function& builtin_cache::object_create(jsi::Runtime& runtime)
+{
+    return get_builtin(m_objectCreate, [&] {
+        return runtime.global().getPropertyAsObject(runtime, "Object").getPropertyAsFunction(runtime, "create");
+    });
+}
 
-    return jsi::Value::undefined();
+const jsi::Function& builtin_cache::object_define_property(jsi::Runtime& runtime)
+{
+    return get_builtin(m_objectDefineProperty, [&] {
+        return runtime.global().getPropertyAsObject(runtime, "Object").getPropertyAsFunction(runtime, "defineProperty");
+    });
 }
 
-jsi::Value projected_enum::get(jsi::Runtime& runtime, const jsi::PropNameID& name)
+const jsi::Function& builtin_cache::object_has_own_property(jsi::Runtime& runtime)
 {
-    return m_data->get_value(runtime, name.utf8(runtime));
+    return get_builtin(m_objectHasOwnProperty, [&] {
+        return runtime.global()
+            .getPropertyAsObject(runtime, "Object")
+            .getPropertyAsObject(runtime, "prototype")
+            .getPropertyAsFunction(runtime, "hasOwnProperty");
+    });
 }
 
-void projected_enum::set(jsi::Runtime& runtime, const jsi::PropNameID& name, const jsi::Value&)
+const jsi::Function& builtin_cache::object_keys(jsi::Runtime& runtime)
 {
-    throw jsi::JSError(
-        runtime, "TypeError: Cannot assign to property '" + name.utf8(runtime) + "' of a projected WinRT enum");
+    return get_builtin(m_objectKeys, [&] {
+        return runtime.global().getPropertyAsObject(runtime, "Object").getPropertyAsFunction(runtime, "keys");
+    });
 }
 
-std::vector<jsi::PropNameID> projected_enum::getPropertyNames(jsi::Runtime& runtime)
+const jsi::Function& builtin_cache::array_buffer(jsi::Runtime& runtime)
 {
-    std::vector<jsi::PropNameID> result;
-    result.reserve(m_data->values.size());
-    for (auto& mapping : m_data->values)
-    {
-        result.push_back(make_propid(runtime, mapping.name));
-        // Reverse mapping (to match TypeScript enums)
-        result.push_back(make_propid(runtime, mapping.value_as_string));
-    }
+    return get_builtin(m_arrayBuffer, [&] { return runtime.global().getPropertyAsFunction(runtime, "ArrayBuffer"); });
+}
 
-    return result;
+const jsi::Function& builtin_cache::array_buffer_is_view(jsi::Runtime& runtime)
+{
+    return get_builtin(
+        m_arrayBufferIsView, [&] { return array_buffer(runtime).getPropertyAsFunction(runtime, "isView"); });
 }
 
-jsi::Value static_class_data::create(jsi::Runtime& runtime) const
+const jsi::Function& builtin_cache::map(jsi::Runtime& runtime)
 {
-    return jsi::Value(
-        runtime, jsi::Object::createFromHostObject(runtime, std::make_shared<projected_statics_class>(this)));
+    return get_builtin(m_map, [&] { return runtime.global().getPropertyAsFunction(runtime, "Map"); });
 }
 
-static jsi::Value static_add_event_listener(jsi::Runtime& runtime, const jsi::Value* args, size_t count,
-    const static_class_data* data, event_registration_array& registrations)
+const jsi::Function& builtin_cache::reflect_delete_property(jsi::Runtime& runtime)
 {
-    if (count < 2)
-    {
-        throw jsi::JSError(runtime, "TypeError: addEventListener expects (at least) 2 arguments");
-    }
+    return get_builtin(m_reflectDeleteProperty, [&] {
+        return runtime.global()
+            .getPropertyAsObject(runtime, "Reflect")
+            .getPropertyAsFunction(runtime, "deleteProperty");
+    });
+}
 
-    auto name = args[0].asString(runtime).utf8(runtime);
-    if (auto itr = find_by_name(data->events, name); itr != data->events.end())
-    {
-        auto token = itr->add(runtime, args[1]);
-        registrations.add(args[1].asObject(runtime), itr->name.data(), token);
-    }
+const jsi::Function& builtin_cache::typed_array(jsi::Runtime& runtime, typed_array_type type)
+{
+    static constexpr const char* names[] = {
+        "Uint8Array",
+        "Int16Array",
+        "Uint16Array",
+        "Int32Array",
+        "Uint32Array",
+        "Float32Array",
+        "Float64Array",
+    };
+    static_assert(std::size(names) == typed_array_type_count);
 
-    return jsi::Value::undefined();
+    auto index = static_cast<std::size_t>(type);
+    return get_builtin(
+        m_typedArrays[index], [&] { return runtime.global().getPropertyAsFunction(runtime, names[index]); });
 }
 
-static jsi::Value static_remove_event_listener(jsi::Runtime& runtime, const jsi::Value* args, size_t count,
-    const static_class_data* data, event_registration_array& registrations)
+void builtin_cache::clear() noexcept
 {
-    if (count < 2)
+    m_date.reset();
+    m_promise.reset();
+    m_promiseThen.reset();
+    m_promiseFinally.reset();
+    m_arrayPrototype.reset();
+    m_arrayPush.reset();
+    m_arraySplice.reset();
+    m_arrayPop.reset();
+    m_arrayFrom.reset();
+    m_objectCreate.reset();
+    m_objectDefineProperty.reset();
+    m_objectHasOwnProperty.reset();
+    m_objectKeys.reset();
+    m_arrayBuffer.reset();
+    m_arrayBufferIsView.reset();
+    m_map.reset();
+    m_reflectDeleteProperty.reset();
+    for (auto& typedArray : m_typedArrays)
     {
-        throw jsi::JSError(runtime, "TypeError: removeEventListener expects (at least) 2 arguments");
+        typedArray.reset();
     }
+}
 
-    auto name = args[0].asString(runtime).utf8(runtime);
-    if (auto itr = find_by_name(data->events, name); itr != data->events.end())
+jsi::ArrayBuffer rnwinrt::make_array_buffer(jsi::Runtime& runtime, const void* data, std::size_t byteLength)
+{
+    auto buffer = current_runtime_context()
+                      ->builtins.array_buffer(runtime)
+                      .callAsConstructor(runtime, static_cast<double>(byteLength))
+                      .asObject(runtime)
+                      .getArrayBuffer(runtime);
+    if (byteLength > 0)
     {
-        auto token = registrations.remove(runtime, args[1].asObject(runtime), itr->name.data());
-        itr->remove(token);
+        std::memcpy(buffer.data(runtime), data, byteLength);
     }
 
-    return jsi::Value::undefined();
+    return buffer;
 }
 
-jsi::Value projected_statics_class::get(jsi::Runtime& runtime, const jsi::PropNameID& id)
+jsi::Value rnwinrt::make_typed_array(
+    jsi::Runtime& runtime, typed_array_type type, const void* data, std::size_t byteLength)
 {
-    auto name = id.utf8(runtime);
-
-    if (auto itr = find_by_name(m_data->properties, name); itr != m_data->properties.end())
-    {
-        return itr->getter(runtime);
-    }
+    auto buffer = make_array_buffer(runtime, data, byteLength);
+    return current_runtime_context()->builtins.typed_array(runtime, type).callAsConstructor(runtime, buffer);
+}
 
-    auto itr = m_functions.find(name);
-    if (itr == m_functions.end())
+std::optional<span<std::uint8_t>> rnwinrt::try_get_typed_array_data(
+    jsi::Runtime& runtime, const jsi::Object& object, typed_array_type type, std::size_t elementSize)
+{
+    if (object.isArrayBuffer(runtime))
     {
-        auto dataItr = find_by_name(m_data->functions, name);
-        if (dataItr != m_data->functions.end())
-        {
-            auto fn = jsi::Function::createFromHostFunction(runtime, id, 0, dataItr->function);
-            itr = m_functions.emplace(dataItr->name, jsi::Value(runtime, std::move(fn))).first;
-        }
-        else if (!m_data->events.empty())
+        auto buffer = object.getArrayBuffer(runtime);
+        auto size = buffer.size(runtime);
+        if ((size % elementSize) != 0)
         {
-            if (name == add_event_name)
-            {
-                auto fn = bind_host_function(runtime, id, 2, &projected_statics_class::add_event_listener);
-                itr = m_functions.emplace(add_event_name, jsi::Value(runtime, std::move(fn))).first;
-            }
-            else if (name == remove_event_name)
-            {
-                auto fn = bind_host_function(runtime, id, 2, &projected_statics_class::remove_event_listener);
-                itr = m_functions.emplace(remove_event_name, jsi::Value(runtime, std::move(fn))).first;
-            }
+            throw jsi::JSError(runtime, "TypeError: ArrayBuffer size " + std::to_string(size) +
+                                            " is not a multiple of the array element size " +
+                                            std::to_string(elementSize));
         }
+
+        return span<std::uint8_t>(buffer.data(runtime), size);
     }
 
-    if (itr == m_functions.end())
+    // NOTE: Arrays are by far the most common input, so avoid the 'instanceof' check for them
+    if (object.isArray(runtime) ||
+        !object.instanceOf(runtime, current_runtime_context()->builtins.typed_array(runtime, type)))
     {
-        return jsi::Value::undefined();
+        return std::nullopt;
     }
 
-    return jsi::Value(runtime, itr->second);
+    auto buffer = object.getPropertyAsObject(runtime, "buffer").getArrayBuffer(runtime);
+    auto offset = static_cast<std::size_t>(object.getProperty(runtime, "byteOffset").asNumber());
+    auto length = static_cast<std::size_t>(object.getProperty(runtime, "byteLength").asNumber());
+    return span<std::uint8_t>(buffer.data(runtime) + offset, length);
 }
 
-void projected_statics_class::set(jsi::Runtime& runtime, const jsi::PropNameID& id, const jsi::Value& value)
+#if RNWINRT_JSI_HAS_MUTABLE_BUFFER
+jsi::Value rnwinrt::make_typed_array(
+    jsi::Runtime& runtime, typed_array_type type, std::shared_ptr<jsi::MutableBuffer> buffer)
 {
-    auto name = id.utf8(runtime);
-    if (auto itr = find_by_name(m_data->properties, name); itr != m_data->properties.end())
+    jsi::ArrayBuffer arrayBuffer(runtime, std::move(buffer));
+    return current_runtime_context()->builtins.typed_array(runtime, type).callAsConstructor(runtime, arrayBuffer);
+}
+#endif
+
+namespace rnwinrt
+{
+    // Implementation of 'IBuffer' over the memory of a JS ArrayBuffer. The IBuffer holds a reference to the ArrayBuffer
+    // so that the memory remains valid for as long as the IBuffer is alive. Note that JSI offers no way to prevent JS
+    // code from detaching (i.e. transferring) the ArrayBuffer in the meantime
+    struct array_buffer_ibuffer :
+        winrt::implements<array_buffer_ibuffer, winrt::Windows::Storage::Streams::IBuffer,
+            ::Windows::Storage::Streams::IBufferByteAccess>
     {
-        // Unlike getters, setters can be null
-        if (itr->setter)
+        array_buffer_ibuffer(jsi::Object arrayBuffer, span<std::uint8_t> data) :
+            m_context(current_runtime_context()->add_reference()), m_arrayBuffer(std::move(arrayBuffer)),
+            m_data(data.data()), m_capacity(static_cast<std::uint32_t>(data.size())), m_length(m_capacity)
         {
-            (*itr->setter)(runtime, value);
         }
-    }
-
-    // If no property exists with the given name, then ignore the call rather than throwing. This is more-or-less
-    // consistent with EdgeHTML WebView.
-}
+
+        ~array_buffer_ibuffer()
+        {
+            // NOTE: Asynchronous operations (e.g. 'IOutputStream::WriteAsync') typically release their buffer on a
+            // background thread
+            release_on_js_thread(m_context, std::move(m_arrayBuffer));
+        }
+
+        winrt::hstring GetRuntimeClassName() const
+        {
+            return L"JsArrayBuffer";
+        }
+
+        // IBuffer functions
+        std::uint32_t Capacity() const noexcept
+        {
+            return m_capacity;
+        }
+
+        std::uint32_t Length() const noexcept
+        {
+            return m_length;
+        }
+
+        void Length(std::uint32_t value)
+        {
+            if (value > m_capacity)
+            {
+                throw winrt::hresult_invalid_argument();
+            }
+
+            m_length = value;
+        }
+
+        // IBufferByteAccess functions
+        HRESULT __stdcall Buffer(std::uint8_t** value) noexcept final
+        {
+            *value = m_data;
+            return S_OK;
+        }
+
+    private:
+        shared_runtime_context m_context;
+        jsi::Object m_arrayBuffer;
+        std::uint8_t* m_data;
+        std::uint32_t m_capacity;
+        std::uint32_t m_length;
+    };
+
+#if RNWINRT_JSI_HAS_MUTABLE_BUFFER
+    // Exposes the memory of an 'IBuffer' to JS as an ArrayBuffer that keeps the IBuffer alive
+    struct ibuffer_array_buffer final : public jsi::MutableBuffer
+    {
+        ibuffer_array_buffer(winrt::Windows::Storage::Streams::IBuffer buffer, std::uint8_t* data, std::size_t size) :
+            m_buffer(std::move(buffer)), m_data(data), m_size(size)
+        {
+        }
+
+        virtual size_t size() const override
+        {
+            return m_size;
+        }
+
+        virtual uint8_t* data() override
+        {
+            return m_data;
+        }
+
+    private:
+        winrt::Windows::Storage::Streams::IBuffer m_buffer;
+        std::uint8_t* m_data;
+        std::size_t m_size;
+    };
+#endif
+}
+
+static std::uint8_t* ibuffer_data(const winrt::Windows::Storage::Streams::IBuffer& buffer)
+{
+    std::uint8_t* result;
+    winrt::check_hresult(buffer.as<::Windows::Storage::Streams::IBufferByteAccess>()->Buffer(&result));
+    return result;
+}
+
+static winrt::Windows::Storage::Streams::IBuffer make_ibuffer(
+    jsi::Runtime& runtime, jsi::Object arrayBuffer, std::size_t offset, std::size_t length)
+{
+    if (length > std::numeric_limits<std::uint32_t>::max())
+    {
+        throw jsi::JSError(runtime, "TypeError: ArrayBuffer of size " + std::to_string(length) +
+                                        " is too large to be used as an IBuffer");
+    }
+
+    auto data = arrayBuffer.getArrayBuffer(runtime).data(runtime) + offset;
+    return winrt::make<array_buffer_ibuffer>(std::move(arrayBuffer), span<std::uint8_t>(data, length));
+}
+
+jsi::Value projected_value_traits<winrt::Windows::Storage::Streams::IBuffer>::as_value(
+    jsi::Runtime& runtime, const winrt::Windows::Storage::Streams::IBuffer& value)
+{
+    if (!value || !current_runtime_context()->buffers_as_array_buffers)
+    {
+        return convert_object_instance_to_value(runtime, value);
+    }
+
+    auto data = ibuffer_data(value);
+    auto length = value.Length();
+
+#if RNWINRT_JSI_HAS_MUTABLE_BUFFER
+    // NOTE: The ArrayBuffer views the bytes that are valid at the time of the conversion (i.e. 'Length', not
+    // 'Capacity') and writes made through it are visible to native code that holds the IBuffer and vice versa
+    jsi::ArrayBuffer result(runtime, std::make_shared<ibuffer_array_buffer>(value, data, length));
+    return jsi::Value(std::move(result));
+#else
+    return jsi::Value(make_array_buffer(runtime, data, length));
+#endif
+}
+
+winrt::Windows::Storage::Streams::IBuffer projected_value_traits<winrt::Windows::Storage::Streams::IBuffer>::as_native(
+    jsi::Runtime& runtime, const jsi::Value& value)
+{
+    if (value.isObject())
+    {
+        auto obj = value.getObject(runtime);
+        if (obj.isArrayBuffer(runtime))
+        {
+            auto size = obj.getArrayBuffer(runtime).size(runtime);
+            return make_ibuffer(runtime, std::move(obj), 0, size);
+        }
+
+        // NOTE: Check for projected objects first to avoid calling into JS for the common case
+        if (!projected_object_instance::from_object(runtime, obj) &&
+            current_runtime_context()->builtins.array_buffer_is_view(runtime).call(runtime, obj).getBool())
+        {
+            auto offset = static_cast<std::size_t>(obj.getProperty(runtime, "byteOffset").asNumber());
+            auto length = static_cast<std::size_t>(obj.getProperty(runtime, "byteLength").asNumber());
+            return make_ibuffer(runtime, obj.getPropertyAsObject(runtime, "buffer"), offset, length);
+        }
+    }
+
+    return convert_value_to_object_instance<winrt::Windows::Storage::Streams::IBuffer>(runtime, value);
+}
+
+promise_wrapper promise_wrapper::create(jsi::Runtime& runtime)
+{
+    // NOTE: The promise callback is called immediately, hence the capture by reference
+    std::optional<jsi::Function> resolveFn, rejectFn;
+    auto callback = jsi::Function::createFromHostFunction(runtime, make_propid(runtime, "callback"), 2,
+        [&](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args, size_t count) {
+            if (count < 2)
+            {
+                throw jsi::JSError(runtime, "Promise callback unexpectedly called with insufficient arguments");
+            }
+
+            resolveFn = args[0].asObject(runtime).asFunction(runtime);
+            rejectFn = args[1].asObject(runtime).asFunction(runtime);
+            return jsi::Value::undefined();
+        });
+
+    auto promise = current_runtime_context()->builtins.promise(runtime).callAsConstructor(runtime, callback);
+    assert(resolveFn && rejectFn);
+    return promise_wrapper(std::move(promise), std::move(*resolveFn), std::move(*rejectFn));
+}
+
+namespace rnwinrt
+{
+    // Reads an 'IInputStream' in chunks on behalf of JS, which consumes the chunks through the async iterator protocol.
+    // Reads are issued one at a time (streams do not support concurrent reads), but ahead of the consumer, so that the
+    // next chunk is typically available by the time JS asks for it. Reading pauses once 'm_readAhead' chunks are
+    // waiting to be consumed. The native buffers that are read into are pooled and reused; each chunk is copied into a
+    // new ArrayBuffer when it is handed to JS since JS may hold onto it indefinitely. All state is accessed on the JS
+    // thread
+    struct stream_reader : std::enable_shared_from_this<stream_reader>
+    {
+        stream_reader(winrt::Windows::Storage::Streams::IInputStream stream, std::uint32_t chunkSize,
+            std::uint32_t readAhead) :
+            m_stream(std::move(stream)), m_chunkSize(chunkSize), m_readAhead(readAhead)
+        {
+        }
+
+        ~stream_reader()
+        {
+            if (m_pendingRead)
+            {
+                m_pendingRead.Cancel();
+            }
+        }
+
+        // Prototype: next() -> Promise<{ value: ArrayBuffer, done: boolean }>
+        jsi::Value next(jsi::Runtime& runtime)
+        {
+            auto promise = promise_wrapper::create(runtime);
+            auto result = jsi::Value(runtime, promise.get());
+            m_requests.push_back(std::move(promise));
+
+            deliver(runtime);
+            read_next(runtime);
+            return result;
+        }
+
+        // Prototype: return() -> Promise<{ value: undefined, done: true }>. Called when a 'for await' loop exits early
+        jsi::Value close(jsi::Runtime& runtime)
+        {
+            m_done = true;
+            if (m_pendingRead)
+            {
+                m_pendingRead.Cancel();
+            }
+
+            m_chunks.clear();
+            m_pool.clear();
+            deliver(runtime);
+
+            auto promise = promise_wrapper::create(runtime);
+            promise.resolve(runtime, make_iterator_result(runtime, jsi::Value::undefined(), true));
+            return jsi::Value(runtime, promise.get());
+        }
+
+    private:
+        struct chunk
+        {
+            winrt::Windows::Storage::Streams::IBuffer buffer; // The pooled buffer that was passed to 'ReadAsync'
+            winrt::Windows::Storage::Streams::IBuffer data; // The buffer returned by 'ReadAsync' (usually the same)
+        };
+
+        static jsi::Value make_iterator_result(jsi::Runtime& runtime, jsi::Value value, bool done)
+        {
+            jsi::Object result(runtime);
+            result.setProperty(runtime, "value", std::move(value));
+            result.setProperty(runtime, "done", done);
+            return jsi::Value(runtime, result);
+        }
+
+        // Satisfies as many outstanding 'next' calls as possible with the chunks that have been read so far
+        void deliver(jsi::Runtime& runtime)
+        {
+            while (!m_requests.empty())
+            {
+                if (!m_chunks.empty())
+                {
+                    auto c = std::move(m_chunks.front());
+                    m_chunks.pop_front();
+
+                    auto value = make_array_buffer(runtime, ibuffer_data(c.data), c.data.Length());
+                    m_pool.push_back(std::move(c.buffer));
+                    complete_request(runtime, make_iterator_result(runtime, jsi::Value(std::move(value)), false), true);
+                }
+                else if (m_error)
+                {
+                    // NOTE: Like other iterators, the reader is finished once it has produced an error
+                    auto error = make_error(runtime, winrt::hresult_error(*std::exchange(m_error, std::nullopt)));
+                    m_done = true;
+                    complete_request(runtime, error, false);
+                }
+                else if (m_done)
+                {
+                    complete_request(runtime, make_iterator_result(runtime, jsi::Value::undefined(), true), true);
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+
+        void complete_request(jsi::Runtime& runtime, const jsi::Value& value, bool resolved)
+        {
+            auto promise = std::move(m_requests.front());
+            m_requests.pop_front();
+            if (resolved)
+            {
+                promise.resolve(runtime, value);
+            }
+            else
+            {
+                promise.reject(runtime, value);
+            }
+        }
+
+        // Issues reads until one is in progress or no more are needed. NOTE: Reads that have already completed invoke
+        // 'on_read_completed' inline (see 'start_read'), which calls back into this function. Rather than recursing (up
+        // to 'm_readAhead' deep), the nested call returns immediately and the outermost call issues the next read
+        void read_next(jsi::Runtime& runtime)
+        {
+            if (m_inReadNext)
+            {
+                return;
+            }
+
+            m_inReadNext = true;
+            while (!m_pendingRead && !m_done && !m_error && (m_chunks.size() < m_readAhead))
+            {
+                start_read(runtime);
+            }
+
+            m_inReadNext = false;
+        }
+
+        void start_read(jsi::Runtime& runtime)
+        {
+            if (m_pool.empty())
+            {
+                m_pendingBuffer = winrt::Windows::Storage::Streams::Buffer(m_chunkSize);
+            }
+            else
+            {
+                m_pendingBuffer = std::move(m_pool.back());
+                m_pool.pop_back();
+            }
+
+            // NOTE: 'Partial' lets streams that produce data incrementally (e.g. network streams) complete the read as
+            // soon as some data is available rather than waiting for a full chunk
+            try
+            {
+                auto read = m_stream.ReadAsync(
+                    m_pendingBuffer, m_chunkSize, winrt::Windows::Storage::Streams::InputStreamOptions::Partial);
+                m_pendingRead = read;
+
+                // NOTE: The handler may be invoked synchronously if the read has already completed, in which case
+                // 'runtime_context::call' invokes 'on_read_completed' inline, which resets 'm_pendingRead'. Hence the
+                // handler is set through a local reference that keeps the operation alive for the duration of the call
+                auto ctxt = current_runtime_context()->add_reference();
+                read.Completed([weakThis = weak_from_this(), ctxt = std::move(ctxt)](
+                                   const auto& operation, winrt::AsyncStatus status) {
+                    ctxt->call([weakThis, operation, status]() {
+                        if (auto strongThis = weakThis.lock())
+                        {
+                            strongThis->on_read_completed(current_runtime_context()->runtime, operation, status);
+                        }
+                    });
+                });
+            }
+            catch (...)
+            {
+                // NOTE: Errors that the stream throws synchronously are reported the same way as errors that the read
+                // operation reports, i.e. by rejecting the next request once all chunks read so far are delivered
+                m_pendingRead = nullptr;
+                if (m_pendingBuffer)
+                {
+                    m_pool.push_back(std::exchange(m_pendingBuffer, nullptr));
+                }
+
+                m_error = winrt::to_hresult();
+                deliver(runtime);
+            }
+        }
+
+        void on_read_completed(jsi::Runtime& runtime,
+            const winrt::IAsyncOperationWithProgress<winrt::Windows::Storage::Streams::IBuffer, std::uint32_t>&
+                operation,
+            winrt::AsyncStatus status)
+        {
+            m_pendingRead = nullptr;
+            auto buffer = std::exchange(m_pendingBuffer, nullptr);
+            if (m_done)
+            {
+                return; // Closed while the read was in progress
+            }
+
+            switch (status)
+            {
+            case winrt::AsyncStatus::Completed:
+                if (auto data = operation.GetResults(); data.Length() > 0)
+                {
+                    m_chunks.push_back({ std::move(buffer), std::move(data) });
+                }
+                else
+                {
+                    m_done = true; // End of stream
+                }
+                break;
+
+            case winrt::AsyncStatus::Error:
+                m_error = operation.ErrorCode();
+                break;
+
+            default:
+                m_done = true;
+                break;
+            }
+
+            deliver(runtime);
+            read_next(runtime);
+        }
+
+        winrt::Windows::Storage::Streams::IInputStream m_stream;
+        std::uint32_t m_chunkSize;
+        std::uint32_t m_readAhead;
+
+        std::vector<winrt::Windows::Storage::Streams::IBuffer> m_pool;
+        std::deque<chunk> m_chunks;
+        std::deque<promise_wrapper> m_requests;
+
+        winrt::IAsyncOperationWithProgress<winrt::Windows::Storage::Streams::IBuffer, std::uint32_t> m_pendingRead{
+            nullptr
+        };
+        winrt::Windows::Storage::Streams::IBuffer m_pendingBuffer{ nullptr };
+        std::optional<winrt::hresult> m_error;
+        bool m_done = false;
+        bool m_inReadNext = false;
+    };
+}
+
+jsi::Value rnwinrt::create_stream_reader(jsi::Runtime& runtime, winrt::Windows::Storage::Streams::IInputStream stream,
+    std::uint32_t chunkSize, std::uint32_t readAhead)
+{
+    auto reader = std::make_shared<stream_reader>(std::move(stream), chunkSize, readAhead);
+
+    jsi::Object result(runtime);
+    result.setProperty(runtime, "next",
+        jsi::Function::createFromHostFunction(runtime, make_propid(runtime, "next"), 0,
+            [reader](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value*, size_t) {
+                return reader->next(runtime);
+            }));
+    result.setProperty(runtime, "return",
+        jsi::Function::createFromHostFunction(runtime, make_propid(runtime, "return"), 0,
+            [reader](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value*, size_t) {
+                return reader->close(runtime);
+            }));
+
+    // The reader is its own async iterable, so that it can be used directly in a 'for await' loop. Engines without
+    // 'Symbol.asyncIterator' rely on Babel's async iteration helper, which falls back to the '@@asyncIterator' property
+    auto selfFn = jsi::Function::createFromHostFunction(runtime, make_propid(runtime, "asyncIterator"), 0,
+        [](jsi::Runtime& runtime, const jsi::Value& thisVal, const jsi::Value*, size_t) {
+            return jsi::Value(runtime, thisVal);
+        });
+    auto asyncIterator = runtime.global().getPropertyAsObject(runtime, "Symbol").getProperty(runtime, "asyncIterator");
+    if (asyncIterator.isSymbol())
+    {
+        jsi::Object descriptor(runtime);
+        descriptor.setProperty(runtime, "value", std::move(selfFn));
+        current_runtime_context()->builtins.object_define_property(runtime).call(
+            runtime, result, asyncIterator, descriptor);
+    }
+    else
+    {
+        result.setProperty(runtime, "@@asyncIterator", std::move(selfFn));
+    }
+
+    return jsi::Value(runtime, result);
+}
+
+template <typename ThingWithName>
+static std::string_view name_of(const ThingWithName& thing) noexcept
+{
+    if constexpr (std::is_pointer_v<ThingWithName>)
+    {
+        return thing->name;
+    }
+    else
+    {
+        return thing.name;
+    }
+}
+
+// NOTE: There can be duplicates in a list (e.g. function overloads) and callers expect the result to be the first. The
+// generated name indices only reference the first entry with a given name, so this holds for both search methods
+template <typename ThingWithName>
+static ThingWithName* find_by_name(span<ThingWithName> list, std::string_view name) noexcept
+{
+    return std::find_if(
+        list.begin(), list.end(), [&](const ThingWithName& thing) { return name_of(thing) == name; });
+}
+
+template <typename ThingWithName>
+static ThingWithName* find_by_name(
+    span<ThingWithName> list, const static_name_index& index, std::string_view name, std::uint32_t hash) noexcept
+{
+    if (index.empty())
+    {
+        return find_by_name(list, name);
+    }
+
+    auto pos = index.find(hash, [&](std::size_t i) { return name_of(list[i]) == name; });
+    return (pos == std::string_view::npos) ? list.end() : (list.begin() + pos);
+}
+
+jsi::Value static_namespace_data::create(jsi::Runtime& runtime) const
+{
+    return jsi::Value(runtime, jsi::Object::createFromHostObject(runtime, std::make_shared<projected_namespace>(this)));
+}
+
+jsi::Value projected_namespace::get(jsi::Runtime& runtime, const jsi::PropNameID& id)
+{
+    auto name = id.utf8(runtime);
+    if (auto itr = find_by_name(m_data->children, m_data->children_index, name, hash_name(name));
+        itr != m_data->children.end())
+    {
+        auto& item = m_children[itr - m_data->children.begin()];
+        if (item.isUndefined())
+        {
+            item = (*itr)->create(runtime);
+        }
+
+        return jsi::Value(runtime, item);
+    }
+
+    return jsi::Value::undefined();
+}
+
+void projected_namespace::set(jsi::Runtime& runtime, const jsi::PropNameID& name, const jsi::Value&)
+{
+    throw jsi::JSError(
+        runtime, "TypeError: Cannot assign to property '" + name.utf8(runtime) + "' of a projected WinRT namespace");
+}
+
+std::vector<jsi::PropNameID> projected_namespace::getPropertyNames(jsi::Runtime& runtime)
+{
+    std::vector<jsi::PropNameID> result;
+    result.reserve(m_children.size());
+    for (auto ptr : m_data->children)
+    {
+        result.push_back(make_propid(runtime, ptr->name));
+    }
+
+    return result;
+}
+
+jsi::Value static_enum_data::create(jsi::Runtime& runtime) const
+{
+    return jsi::Value(runtime, jsi::Object::createFromHostObject(runtime, std::make_shared<projected_enum>(this)));
+}
+
+jsi::Value static_enum_data::get_value(jsi::Runtime& runtime, std::string_view valueName) const
+{
+    auto hash = hash_name(valueName);
+    if (auto itr = find_by_name(values, name_index, valueName, hash); itr != values.end())
+    {
+        return jsi::Value(itr->value);
+    }
+
+    // Look for a matching value (reverse mapping)
+    auto matchValue = [&](const value_mapping& mapping) { return mapping.value_as_string == valueName; };
+    const value_mapping* itr;
+    if (value_index.empty())
+    {
+        itr = std::find_if(values.begin(), values.end(), matchValue);
+    }
+    else
+    {
+        auto pos = value_index.find(hash, [&](std::size_t i) { return matchValue(values[i]); });
+        itr = (pos == std::string_view::npos) ? values.end() : (values.begin() + pos);
+    }
+
+    if (itr != values.end())
+    {
+        return jsi::Value(runtime, make_string(runtime, itr->name));
+    }
+
+    return jsi::Value::undefined();
+}
+
+jsi::Value projected_enum::get(jsi::Runtime& runtime, const jsi::PropNameID& name)
+{
+    return m_data->get_value(runtime, name.utf8(runtime));
+}
+
+void projected_enum::set(jsi::Runtime& runtime, const jsi::PropNameID& name, const jsi::Value&)
+{
+    throw jsi::JSError(
+        runtime, "TypeError: Cannot assign to property '" + name.utf8(runtime) + "' of a projected WinRT enum");
+}
+
+std::vector<jsi::PropNameID> projected_enum::getPropertyNames(jsi::Runtime& runtime)
+{
+    std::vector<jsi::PropNameID> result;
+    result.reserve(m_data->values.size());
+    for (auto& mapping : m_data->values)
+    {
+        result.push_back(make_propid(runtime, mapping.name));
+        // Reverse mapping (to match TypeScript enums)
+        result.push_back(make_propid(runtime, mapping.value_as_string));
+    }
+
+    return result;
+}
+
+jsi::Value static_class_data::create(jsi::Runtime& runtime) const
+{
+    return jsi::Value(
+        runtime, jsi::Object::createFromHostObject(runtime, std::make_shared<projected_statics_class>(this)));
+}
+
+void coalesced_callback::submit(task callback)
+{
+    std::chrono::steady_clock::duration delay{};
+    {
+        winrt::slim_lock_guard lock(m_lock);
+
+        if (m_closed)
+        {
+            return;
+        }
+
+        // NOTE: The superseded callback, if any, ends up in 'callback' and is destroyed after the lock is released
+        std::swap(m_pending, callback);
+        if (m_scheduled)
+        {
+            return;
+        }
+
+        m_scheduled = true;
+        if (m_throttle.count() > 0)
+        {
+            auto now = std::chrono::steady_clock::now();
+            if (auto due = m_lastDelivery + m_throttle; due > now)
+            {
+                delay = due - now;
+            }
+        }
+    }
+
+    if (delay.count() > 0)
+    {
+        deliver_after(shared_from_this(), delay);
+    }
+    else
+    {
+        m_context->call_async([strongThis = shared_from_this()]() { strongThis->deliver(); });
+    }
+}
+
+void coalesced_callback::deliver()
+{
+    task callback;
+    {
+        winrt::slim_lock_guard lock(m_lock);
+        callback = std::move(m_pending);
+        m_scheduled = false;
+        m_lastDelivery = std::chrono::steady_clock::now();
+    }
+
+    if (callback)
+    {
+        callback();
+    }
+}
+
+void coalesced_callback::close()
+{
+    task callback;
+    {
+        winrt::slim_lock_guard lock(m_lock);
+        callback = std::move(m_pending);
+        m_closed = true;
+    }
+
+    if (callback)
+    {
+        callback();
+    }
+}
+
+winrt::fire_and_forget coalesced_callback::deliver_after(
+    std::shared_ptr<coalesced_callback> self, std::chrono::steady_clock::duration delay)
+{
+    co_await winrt::resume_after(std::chrono::duration_cast<winrt::TimeSpan>(delay));
+    self->m_context->call_async([self]() { self->deliver(); });
+}
+
+async_delegate_function::async_delegate_function(
+    jsi::Runtime& runtime, const jsi::Value& value, const event_options& options) :
+    m_context(current_runtime_context()->add_reference()),
+    m_function(value.asObject(runtime).asFunction(runtime))
+{
+    if (options.latest_only || (options.throttle.count() > 0))
+    {
+        m_coalescer = std::make_shared<coalesced_callback>(m_context, options.throttle);
+    }
+}
+
+async_delegate_function::~async_delegate_function()
+{
+    // The last reference may be released by the event source on any thread
+    release_on_js_thread(m_context, std::move(m_function));
+}
+
+std::shared_ptr<async_delegate_function> async_delegate_function::create(
+    jsi::Runtime& runtime, const jsi::Value& value)
+{
+    auto& options = current_runtime_context()->delegate_options;
+    if (options.delivery != event_delivery::async)
+    {
+        return nullptr;
+    }
+
+    return std::make_shared<async_delegate_function>(runtime, value, options);
+}
+
+collection_mirror::collection_mirror(jsi::Runtime& runtime, const jsi::Object& mirror) :
+    context(current_runtime_context()->add_reference()), m_mirror(runtime, mirror)
+{
+}
+
+collection_mirror::~collection_mirror()
+{
+    // The last reference is held by the collection's change handler, which may be released on any thread
+    release_on_js_thread(context, std::move(m_mirror));
+}
+
+std::optional<jsi::Object> collection_mirror::target(jsi::Runtime& runtime, uint64_t change, bool& isAlive)
+{
+    auto mirror = m_mirror.lock(runtime);
+    isAlive = mirror.isObject();
+    if (!isAlive || (change <= m_snapshotChange))
+    {
+        return std::nullopt;
+    }
+
+    return mirror.getObject(runtime);
+}
+
+// Applies the options that can be passed as the third argument to 'addEventListener' to the delegate that gets created
+// for the listener. Options are '{ async: boolean, latestOnly: boolean, throttleMs: number }'; see 'event_options' for
+// details. 'async' overrides the runtime's 'default_event_delivery' and is implied by the other two
+struct event_listener_options_scope
+{
+    event_listener_options_scope(jsi::Runtime& runtime, const jsi::Value* args, size_t count) :
+        m_context(current_runtime_context()), m_previousOptions(m_context->delegate_options)
+    {
+        event_options options;
+        options.delivery = m_context->default_event_delivery;
+        if ((count > 2) && args[2].isObject())
+        {
+            auto optionsObj = args[2].getObject(runtime);
+            auto async = optionsObj.getProperty(runtime, "async");
+            if (async.isBool())
+            {
+                options.delivery = async.getBool() ? event_delivery::async : event_delivery::sync;
+            }
+
+            if (auto latestOnly = optionsObj.getProperty(runtime, "latestOnly"); latestOnly.isBool())
+            {
+                options.latest_only = latestOnly.getBool();
+            }
+
+            if (auto throttle = optionsObj.getProperty(runtime, "throttleMs"); !throttle.isUndefined())
+            {
+                if (!throttle.isNumber() || !(throttle.getNumber() >= 0))
+                {
+                    throw jsi::JSError(runtime, "TypeError: throttleMs must be a non-negative number");
+                }
+
+                auto ms = std::min(throttle.getNumber(), static_cast<double>(UINT32_MAX));
+                options.throttle = std::chrono::milliseconds(static_cast<int64_t>(ms));
+            }
+
+            if (options.latest_only || (options.throttle.count() > 0))
+            {
+                if (async.isBool() && !async.getBool())
+                {
+                    throw jsi::JSError(runtime, "TypeError: latestOnly and throttleMs require asynchronous delivery");
+                }
+
+                options.delivery = event_delivery::async;
+            }
+        }
+
+        m_context->delegate_options = options;
+    }
+
+    event_listener_options_scope(const event_listener_options_scope&) = delete;
+    event_listener_options_scope& operator=(const event_listener_options_scope&) = delete;
+
+    ~event_listener_options_scope()
+    {
+        m_context->delegate_options = m_previousOptions;
+    }
+
+private:
+    runtime_context* m_context;
+    event_options m_previousOptions;
+};
+
+static jsi::Value static_add_event_listener(jsi::Runtime& runtime, const jsi::Value* args, size_t count,
+    const static_class_data* data, event_registration_array& registrations)
+{
+    if (count < 2)
+    {
+        throw jsi::JSError(runtime, "TypeError: addEventListener expects (at least) 2 arguments");
+    }
+
+    event_listener_options_scope options(runtime, args, count);
+
+    auto name = args[0].asString(runtime).utf8(runtime);
+    if (auto itr = find_by_name(data->events, data->indices.events, name, hash_name(name)); itr != data->events.end())
+    {
+        auto token = itr->add(runtime, args[1]);
+        registrations.add(args[1].asObject(runtime), itr->name.data(), token);
+    }
+
+    return jsi::Value::undefined();
+}
+
+static jsi::Value static_remove_event_listener(jsi::Runtime& runtime, const jsi::Value* args, size_t count,
+    const static_class_data* data, event_registration_array& registrations)
+{
+    if (count < 2)
+    {
+        throw jsi::JSError(runtime, "TypeError: removeEventListener expects (at least) 2 arguments");
+    }
+
+    auto name = args[0].asString(runtime).utf8(runtime);
+    if (auto itr = find_by_name(data->events, data->indices.events, name, hash_name(name)); itr != data->events.end())
+    {
+        auto token = registrations.remove(runtime, args[1].asObject(runtime), itr->name.data());
+        itr->remove(token);
+    }
+
+    return jsi::Value::undefined();
+}
+
+jsi::Value projected_statics_class::get(jsi::Runtime& runtime, const jsi::PropNameID& id)
+{
+    auto name = id.utf8(runtime);
+    auto hash = hash_name(name);
+
+    if (auto itr = find_by_name(m_data->properties, m_data->indices.properties, name, hash);
+        itr != m_data->properties.end())
+    {
+        return itr->getter(runtime);
+    }
+
+    auto itr = m_functions.find(name);
+    if (itr == m_functions.end())
+    {
+        auto dataItr = find_by_name(m_data->functions, m_data->indices.functions, name, hash);
+        if (dataItr != m_data->functions.end())
+        {
+            auto fn = jsi::Function::createFromHostFunction(runtime, id, 0, dataItr->function);
+            itr = m_functions.emplace(dataItr->name, jsi::Value(runtime, std::move(fn))).first;
+        }
+        else if (!m_data->events.empty())
+        {
+            if (name == add_event_name)
+            {
+                auto fn = bind_host_function(runtime, id, 2, &projected_statics_class::add_event_listener);
+                itr = m_functions.emplace(add_event_name, jsi::Value(runtime, std::move(fn))).first;
+            }
+            else if (name == remove_event_name)
+            {
+                auto fn = bind_host_function(runtime, id, 2, &projected_statics_class::remove_event_listener);
+                itr = m_functions.emplace(remove_event_name, jsi::Value(runtime, std::move(fn))).first;
+            }
+        }
+    }
+
+    if (itr == m_functions.end())
+    {
+        return jsi::Value::undefined();
+    }
+
+    return jsi::Value(runtime, itr->second);
+}
+
+void projected_statics_class::set(jsi::Runtime& runtime, const jsi::PropNameID& id, const jsi::Value& value)
+{
+    auto name = id.utf8(runtime);
+    if (auto itr = find_by_name(m_data->properties, m_data->indices.properties, name, hash_name(name));
+        itr != m_data->properties.end())
+    {
+        // Unlike getters, setters can be null
+        if (itr->setter)
+        {
+            (*itr->setter)(runtime, value);
+        }
+    }
+
+    // If no property exists with the given name, then ignore the call rather than throwing. This is more-or-less
+    // consistent with EdgeHTML WebView.
+}
 
 std::vector<jsi::PropNameID> projected_statics_class::getPropertyNames(jsi::Runtime& runtime)
 {
@@ -364,171 +1336,481 @@ std::vector<jsi::PropNameID> projected_statics_class::getPropertyNames(jsi::Runt
         result.push_back(make_propid(runtime, data.name));
     }
 
-    if (!m_data->events.empty())
+    if (!m_data->events.empty())
+    {
+        result.push_back(make_propid(runtime, add_event_name));
+        result.push_back(make_propid(runtime, remove_event_name));
+    }
+
+    return result;
+}
+
+jsi::Value projected_statics_class::add_event_listener(jsi::Runtime& runtime, const jsi::Value* args, size_t count)
+{
+    return static_add_event_listener(runtime, args, count, m_data, m_events);
+}
+
+jsi::Value projected_statics_class::remove_event_listener(jsi::Runtime& runtime, const jsi::Value* args, size_t count)
+{
+    return static_remove_event_listener(runtime, args, count, m_data, m_events);
+}
+
+jsi::Value static_activatable_class_data::create(jsi::Runtime& runtime) const
+{
+    auto code = "(function() { return "s;
+    code.append(full_namespace);
+    code.append(".");
+    code.append(name);
+    code.append(".ctor.apply(this, arguments); })");
+    auto result = runtime.evaluateJavaScript(std::make_shared<jsi::StringBuffer>(std::move(code)), "Activatable Class")
+                      .asObject(runtime);
+
+    // TODO: param count? Seems to not matter? It would be rather simple to calculate when generating the constructor
+    // function, but would also be more data...
+    result.setProperty(
+        runtime, "ctor", jsi::Function::createFromHostFunction(runtime, make_propid(runtime, name), 0, constructor));
+
+    // JSI does not allow us to create a 'Function' that is also a 'HostObject' and therefore cannot provide virtual
+    // get/set functions and instead must attach them to the function object
+    auto& defineProperty = current_runtime_context()->builtins.object_define_property(runtime);
+    for (auto&& prop : properties)
+    {
+        jsi::Object propDesc(runtime);
+        propDesc.setProperty(runtime, "get",
+            jsi::Function::createFromHostFunction(runtime, make_propid(runtime, "get"), 0,
+                [getter = prop.getter](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value*, size_t count) {
+                    if (count != 0)
+                    {
+                        throw jsi::JSError(runtime, "TypeError: Property getter expects 0 arguments");
+                    }
+
+                    return getter(runtime);
+                }));
+        if (prop.setter)
+        {
+            propDesc.setProperty(runtime, "set",
+                jsi::Function::createFromHostFunction(runtime, make_propid(runtime, "set"), 1,
+                    [setter = prop.setter](
+                        jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args, size_t count) {
+                        if (count != 1)
+                        {
+                            throw jsi::JSError(runtime, "TypeError: Property setter expects 1 argument");
+                        }
+
+                        setter(runtime, args[0]);
+                        return jsi::Value::undefined();
+                    }));
+        }
+
+        defineProperty.call(runtime, result, make_string(runtime, prop.name), std::move(propDesc));
+    }
+
+    for (auto&& fn : functions)
+    {
+        auto propId = make_propid(runtime, fn.name);
+        result.setProperty(runtime, propId, jsi::Function::createFromHostFunction(runtime, propId, 0, fn.function));
+    }
+
+    if (!events.empty())
+    {
+        // NOTE: We need shared state, but there's not really a good way to store that state on the function object that
+        // we return... Use a unique_ptr here and give ownership to a single lambda. Neither should outlive the object
+        // we return, so this should be okay
+        auto evtArray = std::make_unique<event_registration_array>();
+
+        auto propId = make_propid(runtime, add_event_name);
+        result.setProperty(runtime, propId,
+            jsi::Function::createFromHostFunction(runtime, propId, 0,
+                [this, evtArray = evtArray.get()](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args,
+                    size_t count) { return static_add_event_listener(runtime, args, count, this, *evtArray); }));
+
+        propId = make_propid(runtime, remove_event_name);
+        result.setProperty(runtime, propId,
+            jsi::Function::createFromHostFunction(runtime, propId, 0,
+                move_only_lambda([this, evtArray = std::move(evtArray)](
+                                     jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args, size_t count) {
+                    return static_remove_event_listener(runtime, args, count, this, *evtArray);
+                })));
+    }
+
+    return result;
+}
+
+#ifndef _WIN32
+static_assert(false, "Compilation requires a little-endian target");
+#endif
+
+// NOTE: Must be kept in-sync with the copy in MetadataTypes.h
+static std::uint32_t hash_guid(const winrt::guid& value, std::uint32_t seed) noexcept
+{
+    auto ptr = reinterpret_cast<const std::uint64_t*>(&value);
+    auto hash = (ptr[0] ^ (seed * 0x9E3779B97F4A7C15ull)) * 0xBF58476D1CE4E5B9ull;
+    hash = (hash ^ (hash >> 31) ^ ptr[1]) * 0x94D049BB133111EBull;
+    return static_cast<std::uint32_t>(hash ^ (hash >> 32));
+}
+
+static const static_interface_data* find_interface(const winrt::guid& guid)
+{
+    if (global_interface_map.empty())
+    {
+        return nullptr;
+    }
+
+    // NOTE: The seed table is a minimal perfect hash generated by rnwinrt. IIDs that aren't projected will still map to
+    // some slot, hence the final comparison
+    auto seed = global_interface_map_seeds[hash_guid(guid, 0) % global_interface_map_seeds.size()];
+    auto slot = (seed < 0) ? static_cast<std::size_t>(-(seed + 1)) :
+                             (hash_guid(guid, static_cast<std::uint32_t>(seed)) % global_interface_map.size());
+
+    auto& entry = global_interface_map[slot];
+    return (entry.first == guid) ? entry.second : nullptr;
+}
+
+static std::uint32_t hash_iids(const winrt::com_array<winrt::guid>& iids) noexcept
+{
+    std::uint32_t result = 0;
+    for (auto&& iid : iids)
+    {
+        result = hash_guid(iid, result);
+    }
+
+    return result;
+}
+
+// C++/WinRT objects that don't override 'GetRuntimeClassName' report the name of their first interface (e.g.
+// "Windows.Foundation.Collections.IVector`1<String>"), so the name alone does not identify the set of interfaces
+static bool is_interface_name(std::wstring_view name) noexcept
+{
+    if (name.find(L'`') != std::wstring_view::npos)
+    {
+        return true;
+    }
+
+    auto pos = name.rfind(L'.');
+    auto typeName = (pos == std::wstring_view::npos) ? name : name.substr(pos + 1);
+    return (typeName.size() >= 2) && (typeName[0] == L'I') && (typeName[1] >= L'A') && (typeName[1] <= L'Z');
+}
+
+std::shared_ptr<runtime_class_data> runtime_class_data::get(const winrt::IInspectable& instance)
+{
+    auto create = [&](const winrt::com_array<winrt::guid>& iids) {
+        auto result = std::make_shared<runtime_class_data>();
+        result->iid_count = iids.size();
+        result->iid_hash = hash_iids(iids);
+        for (auto&& iid : iids)
+        {
+            if (iid == winrt::guid_of<winrt::IPropertyValue>())
+            {
+                result->is_property_value = true;
+            }
+
+            if (auto iface = find_interface(iid))
+            {
+                result->interfaces.push_back(iface);
+                result->has_events = result->has_events || !iface->events.empty();
+                result->has_dynamic_properties =
+                    result->has_dynamic_properties || iface->runtime_get_property || iface->runtime_set_property;
+            }
+        }
+
+        return result;
+    };
+
+    // NOTE: Objects that don't report a class name get data of their own since there's nothing that we can use to
+    // identify other objects that have the same set of interfaces
+    winrt::hstring className;
+    if (SUCCEEDED(static_cast<::IInspectable*>(winrt::get_abi(instance))
+                      ->GetRuntimeClassName(reinterpret_cast<HSTRING*>(winrt::put_abi(className)))) &&
+        !className.empty())
+    {
+        auto& result = current_runtime_context()->class_cache[className];
+        if (!result)
+        {
+            result = create(winrt::get_interfaces(instance));
+            result->is_cached = true;
+        }
+        else if (is_interface_name(className))
+        {
+            // NOTE: Different implementations can report the same interface name, so the cached data is only used
+            // if the object implements the same interfaces as the object it was created from. Otherwise, the object
+            // gets data of its own
+            auto iids = winrt::get_interfaces(instance);
+            if ((iids.size() != result->iid_count) || (hash_iids(iids) != result->iid_hash))
+            {
+                return create(iids);
+            }
+        }
+
+        return result;
+    }
+
+    return create(winrt::get_interfaces(instance));
+}
+
+jsi::Value object_instance_cache::get_instance(
+    jsi::Runtime& runtime, const winrt::IInspectable& value, bool unboxPropertyValues)
+{
+    if ((std::chrono::steady_clock::now() - last_cleanup) >= cleanup_interval)
+    {
+        cleanup(runtime);
+    }
+
+    // NOTE: Each interface has its own associated v-table, so two IInspectable pointers to the same object may actually
+    // be different if they were originally pointers to two different interfaces. Hence the QI here
+    auto instance = value.as<winrt::IInspectable>();
+    auto key = winrt::get_abi(instance);
+    if (auto itr = instances.find(key); itr != instances.end())
+    {
+        // NOTE: It is possible for an interface to get deallocated and have its memory address reused for a new object,
+        // however because we hold strong references to WinRT objects and weak references to the JS objects we create,
+        // this would imply that the JS object also got GC'd and would fail to resolve below
+        if (supports_weak_object)
+        {
+            if (auto strongValue = std::get<0>(itr->second).lock(runtime); !strongValue.isUndefined())
+            {
+                return strongValue;
+            }
+        }
+        else
+        {
+            if (auto hostObj = std::get<1>(itr->second).lock())
+            {
+                auto classData = hostObj->class_data();
+                return jsi::Value(runtime, classData->create_object(runtime, std::move(hostObj)));
+            }
+        }
+
+        // Otherwise, the object has been GC'd. Remove it so that we can re-create the object below
+        instances.erase(itr);
+    }
+
+    auto classData = runtime_class_data::get(instance);
+    if (unboxPropertyValues && classData->is_property_value)
+    {
+        if (auto result = convert_from_property_value(runtime, instance.as<winrt::IPropertyValue>());
+            !result.isUndefined())
+        {
+            return result;
+        }
+    }
+
+    auto hostObj = std::make_shared<projected_object_instance>(instance, classData);
+    auto obj = classData->create_object(runtime, hostObj);
+    if (supports_weak_object)
+    {
+        try
+        {
+            instances.emplace(key, jsi::WeakObject(runtime, obj));
+        }
+        catch (std::logic_error&)
+        {
+            supports_weak_object = false;
+        }
+    }
+
+    if (!supports_weak_object)
+    {
+        instances.emplace(key, std::move(hostObj));
+    }
+
+    return jsi::Value(runtime, std::move(obj));
+}
+
+const runtime_class_data::member_data* runtime_class_data::find_member(
+    jsi::Runtime& runtime, const jsi::PropNameID& id, std::string& name)
+{
+    auto& stats = current_runtime_context()->statistics;
+    ++stats.member_lookups;
+
+    for (auto& entry : m_recentIds)
+    {
+        if (jsi::PropNameID::compare(runtime, entry.id, id))
+        {
+            ++stats.member_table_hits;
+            return entry.member;
+        }
+    }
+
+    name = id.utf8(runtime);
+    const member_data* result;
+    if (auto itr = m_members.find(name); itr != m_members.end())
+    {
+        ++stats.member_table_hits;
+        result = &itr->second;
+    }
+    else
+    {
+        result = resolve_member(name);
+        if (!result)
+        {
+            // NOTE: Names that aren't members (e.g. indices into a vector) are intentionally not cached since there's
+            // no bound on how many of them there may be
+            return nullptr;
+        }
+    }
+
+    if (m_recentIds.size() < recent_ids_size)
     {
-        result.push_back(make_propid(runtime, add_event_name));
-        result.push_back(make_propid(runtime, remove_event_name));
+        m_recentIds.push_back({ jsi::PropNameID(runtime, id), result });
+    }
+    else
+    {
+        m_recentIds[m_nextRecentId] = { jsi::PropNameID(runtime, id), result };
+        m_nextRecentId = (m_nextRecentId + 1) % recent_ids_size;
     }
 
     return result;
 }
 
-jsi::Value projected_statics_class::add_event_listener(jsi::Runtime& runtime, const jsi::Value* args, size_t count)
+const runtime_class_data::member_data* runtime_class_data::resolve_member(std::string_view name)
 {
-    return static_add_event_listener(runtime, args, count, m_data, m_events);
-}
+    member_data member;
+    auto hash = hash_name(name);
+    for (size_t i = 0; i < interfaces.size(); ++i)
+    {
+        auto iface = interfaces[i];
+        if (auto itr = find_by_name(iface->properties, iface->indices.properties, name, hash);
+            itr != iface->properties.end())
+        {
+            if (!member.getter && itr->getter)
+            {
+                member.getter = itr->getter;
+                member.getter_interface = i;
+            }
 
-jsi::Value projected_statics_class::remove_event_listener(jsi::Runtime& runtime, const jsi::Value* args, size_t count)
-{
-    return static_remove_event_listener(runtime, args, count, m_data, m_events);
-}
+            if (!member.setter && itr->setter)
+            {
+                member.setter = itr->setter;
+                member.setter_interface = i;
+            }
+        }
 
-jsi::Value static_activatable_class_data::create(jsi::Runtime& runtime) const
-{
-    auto code = "(function() { return "s;
-    code.append(full_namespace);
-    code.append(".");
-    code.append(name);
-    code.append(".ctor.apply(this, arguments); })");
-    auto result = runtime.evaluateJavaScript(std::make_shared<jsi::StringBuffer>(std::move(code)), "Activatable Class")
-                      .asObject(runtime);
+        if (auto dataItr = find_by_name(iface->functions, iface->indices.functions, name, hash);
+            dataItr != iface->functions.end())
+        {
+            member.functions.push_back({ iface, &*dataItr, i });
 
-    // TODO: param count? Seems to not matter? It would be rather simple to calculate when generating the constructor
-    // function, but would also be more data...
-    result.setProperty(
-        runtime, "ctor", jsi::Function::createFromHostFunction(runtime, make_propid(runtime, name), 0, constructor));
+            // NOTE: Functions are sorted, so this should be the first of N consecutive functions with the same name
+            for (++dataItr; (dataItr != iface->functions.end()) && (dataItr->name == name); ++dataItr)
+            {
+                member.functions.push_back({ iface, &*dataItr, i });
+            }
+        }
+    }
 
-    // JSI does not allow us to create a 'Function' that is also a 'HostObject' and therefore cannot provide virtual
-    // get/set functions and instead must attach them to the function object
-    auto defineProperty =
-        runtime.global().getPropertyAsFunction(runtime, "Object").getPropertyAsFunction(runtime, "defineProperty");
-    for (auto&& prop : properties)
+    auto& functions = member.functions;
+    if (functions.size() > 1)
     {
-        jsi::Object propDesc(runtime);
-        propDesc.setProperty(runtime, "get",
-            jsi::Function::createFromHostFunction(runtime, make_propid(runtime, "get"), 0,
-                [getter = prop.getter](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value*, size_t count) {
-                    if (count != 0)
+        // Make sure there are no conflicts in arity. While this isn't technically 100% necessary, we still at least
+        // need to validate that default overloads are at the front of the list
+        // NOTE: The number of overloads should be pretty minimal, so doing this in a "selection sort-like" way should
+        // be fine
+        for (size_t i = 0; i < functions.size(); ++i)
+        {
+            // NOTE: Even if the target is the default overload, we still want to remove other ones with the same arity
+            auto tgt = functions[i].mapping;
+            for (size_t j = i + 1; j < functions.size();)
+            {
+                auto test = functions[j].mapping;
+                if (tgt->arity == test->arity)
+                {
+                    if (!tgt->is_default_overload && test->is_default_overload)
                     {
-                        throw jsi::JSError(runtime, "TypeError: Property getter expects 0 arguments");
+                        // Use the other one
+                        tgt = test;
+                        functions[i] = functions[j];
                     }
 
-                    return getter(runtime);
-                }));
-        if (prop.setter)
-        {
-            propDesc.setProperty(runtime, "set",
-                jsi::Function::createFromHostFunction(runtime, make_propid(runtime, "set"), 1,
-                    [setter = prop.setter](
-                        jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args, size_t count) {
-                        if (count != 1)
-                        {
-                            throw jsi::JSError(runtime, "TypeError: Property setter expects 1 argument");
-                        }
+                    functions[j] = functions.back();
+                    functions.pop_back();
+                    continue;
+                }
 
-                        setter(runtime, args[0]);
-                        return jsi::Value::undefined();
-                    }));
+                ++j;
+            }
         }
-
-        defineProperty.call(runtime, result, make_string(runtime, prop.name), std::move(propDesc));
     }
 
-    for (auto&& fn : functions)
+    if (!member.getter && functions.empty() && has_events)
     {
-        auto propId = make_propid(runtime, fn.name);
-        result.setProperty(runtime, propId, jsi::Function::createFromHostFunction(runtime, propId, 0, fn.function));
+        member.is_event_function = (name == add_event_name) || (name == remove_event_name);
     }
 
-    if (!events.empty())
+    if (!member.getter && !member.setter && functions.empty() && !member.is_event_function)
     {
-        // NOTE: We need shared state, but there's not really a good way to store that state on the function object that
-        // we return... Use a unique_ptr here and give ownership to a single lambda. Neither should outlive the object
-        // we return, so this should be okay
-        auto evtArray = std::make_unique<event_registration_array>();
-
-        auto propId = make_propid(runtime, add_event_name);
-        result.setProperty(runtime, propId,
-            jsi::Function::createFromHostFunction(runtime, propId, 0,
-                [this, evtArray = evtArray.get()](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args,
-                    size_t count) { return static_add_event_listener(runtime, args, count, this, *evtArray); }));
-
-        propId = make_propid(runtime, remove_event_name);
-        result.setProperty(runtime, propId,
-            jsi::Function::createFromHostFunction(runtime, propId, 0,
-                move_only_lambda([this, evtArray = std::move(evtArray)](
-                                     jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args, size_t count) {
-                    return static_remove_event_listener(runtime, args, count, this, *evtArray);
-                })));
+        return nullptr;
     }
 
-    return result;
+    auto itr = m_members.emplace(std::string(name), std::move(member)).first;
+    itr->second.name = itr->first;
+    return &itr->second;
 }
 
-#ifndef _WIN32
-static_assert(false, "Compilation requires a little-endian target");
-#endif
+projected_object_instance::projected_object_instance(
+    const winrt::IInspectable& instance, std::shared_ptr<runtime_class_data> classData) :
+    m_instance(instance), m_class(std::move(classData))
+{
+    m_interfaces.resize(m_class->interfaces.size());
+}
 
-// NOTE: Must be kept in-sync with the copy in MetadataTypes.h
-static int compare_guid(const winrt::guid& lhs, const winrt::guid& rhs)
+queried_interface projected_object_instance::query_interface(size_t index)
 {
-    // NOTE: This method of comparison needs to remain consistant with how we sort the static array
-    auto lhsPtr = reinterpret_cast<const std::int64_t*>(&lhs);
-    auto rhsPtr = reinterpret_cast<const std::int64_t*>(&rhs);
-    if (auto diff = lhsPtr[0] - rhsPtr[0])
+    auto& iid = m_class->interfaces[index]->guid;
+    auto& result = m_interfaces[index];
+    if (!result)
     {
-        return (diff < 0) ? -1 : 1;
+        winrt::check_hresult(m_instance.as(iid, winrt::put_abi(result)));
     }
 
-    auto diff = lhsPtr[1] - rhsPtr[1];
-    return (diff == 0) ? 0 : (diff < 0) ? -1 : 1;
+    // NOTE: 'm_interfaces' never gets resized, so the reference to the element remains valid
+    return queried_interface(result, iid);
 }
 
-static const static_interface_data* find_interface(const winrt::guid& guid)
+queried_interface projected_object_instance::query_interface(const static_interface_data* iface, size_t index)
 {
-    auto begin = global_interface_map.begin();
-    auto end = global_interface_map.end();
-    static constexpr std::ptrdiff_t linear_search_size = 16; // TODO: Find a good value
-
-    while ((end - begin) > linear_search_size)
+    auto& interfaces = m_class->interfaces;
+    if ((index >= interfaces.size()) || (interfaces[index] != iface))
     {
-        auto mid = begin + (end - begin) / 2;
-        auto cmp = compare_guid(guid, mid->first);
-        if (cmp < 0)
-        {
-            end = mid;
-        }
-        else if (cmp > 0)
+        // E.g. a function that was retrieved from an instance of one class and called with an instance of another
+        auto itr = std::find(interfaces.begin(), interfaces.end(), iface);
+        if (itr == interfaces.end())
         {
-            begin = mid + 1;
-        }
-        else
-        {
-            return mid->second;
+            throw winrt::hresult_no_interface();
         }
+
+        index = static_cast<size_t>(itr - interfaces.begin());
     }
 
-    for (; begin != end; ++begin)
+    return query_interface(index);
+}
+
+std::shared_ptr<projected_object_instance> projected_object_instance::from_object(
+    jsi::Runtime& runtime, const jsi::Object& object)
+{
+    if (object.isHostObject<projected_object_instance>(runtime))
     {
-        if (begin->first == guid)
-        {
-            return begin->second;
-        }
+        return object.getHostObject<projected_object_instance>(runtime);
+    }
+    else if (object.hasNativeState<projected_object_instance>(runtime))
+    {
+        return object.getNativeState<projected_object_instance>(runtime);
     }
 
     return nullptr;
 }
 
-projected_object_instance::projected_object_instance(const winrt::IInspectable& instance) : m_instance(instance)
+std::shared_ptr<projected_object_instance> projected_object_instance::from_this(
+    jsi::Runtime& runtime, const jsi::Value& thisValue)
 {
-    auto iids = winrt::get_interfaces(m_instance);
-    for (auto&& iid : iids)
+    if (thisValue.isObject())
     {
-        if (auto iface = find_interface(iid))
+        if (auto result = from_object(runtime, thisValue.getObject(runtime)))
         {
-            m_interfaces.push_back(iface);
+            return result;
         }
     }
+
+    throw jsi::JSError(runtime, "TypeError: 'this' is not a WinRT object");
 }
 
 namespace rnwinrt
@@ -538,18 +1820,18 @@ namespace rnwinrt
         jsi::Value operator()(
             jsi::Runtime& runtime, const jsi::Value& thisVal, const jsi::Value* args, size_t count) const
         {
-            if (count != data->arity)
+            if (count != data.mapping->arity)
             {
-                throw jsi::JSError(runtime, "TypeError: Non-overloaded function " + std::string(data->name) +
-                                                " expects " + std::to_string(data->arity) + " arguments, but " +
+                throw jsi::JSError(runtime, "TypeError: Non-overloaded function " + std::string(data.mapping->name) +
+                                                " expects " + std::to_string(data.mapping->arity) + " arguments, but " +
                                                 std::to_string(count) + " provided");
             }
 
-            auto obj = thisVal.asObject(runtime).asHostObject<projected_object_instance>(runtime);
-            return data->function(runtime, obj->m_instance, args);
+            auto obj = projected_object_instance::from_this(runtime, thisVal);
+            return data.mapping->function(runtime, obj->query_interface(data.iface, data.interface_index), args);
         }
 
-        const static_interface_data::function_mapping* data;
+        runtime_class_data::function_data data;
     };
 
     struct projected_overloaded_function
@@ -557,126 +1839,244 @@ namespace rnwinrt
         jsi::Value operator()(
             jsi::Runtime& runtime, const jsi::Value& thisVal, const jsi::Value* args, size_t count) const
         {
-            for (auto func : data)
+            for (auto& func : data)
             {
-                if (func->arity == count)
+                if (func.mapping->arity == count)
                 {
-                    auto obj = thisVal.asObject(runtime).asHostObject<projected_object_instance>(runtime);
-                    return func->function(runtime, obj->m_instance, args);
+                    auto obj = projected_object_instance::from_this(runtime, thisVal);
+                    return func.mapping->function(
+                        runtime, obj->query_interface(func.iface, func.interface_index), args);
                 }
             }
 
-            throw jsi::JSError(runtime, "TypeError: Overloaded function " + std::string(data[0]->name) +
+            throw jsi::JSError(runtime, "TypeError: Overloaded function " + std::string(data[0].mapping->name) +
                                             " does not have an overload that expects " + std::to_string(count) +
                                             " arguments");
         }
 
         // TODO: Figure out a good SSO size (4 might be larger than we need most of the time. Perhaps 2?)
-        sso_vector<const static_interface_data::function_mapping*, 4> data;
+        sso_vector<runtime_class_data::function_data, 4> data;
+    };
+
+    // Accessors for the properties defined on the prototypes created when the 'projection_mode' is 'prototype'
+    struct projected_property_getter
+    {
+        jsi::Value operator()(jsi::Runtime& runtime, const jsi::Value& thisVal, const jsi::Value*, size_t) const
+        {
+            auto obj = projected_object_instance::from_this(runtime, thisVal);
+            return getter(runtime, obj->query_interface(iface, interface_index));
+        }
+
+        instance_get_property_t getter;
+        const static_interface_data* iface;
+        size_t interface_index;
+    };
+
+    struct projected_property_setter
+    {
+        jsi::Value operator()(
+            jsi::Runtime& runtime, const jsi::Value& thisVal, const jsi::Value* args, size_t count) const
+        {
+            const jsi::Value undefinedValue;
+            auto obj = projected_object_instance::from_this(runtime, thisVal);
+            setter(runtime, obj->query_interface(iface, interface_index), (count > 0) ? args[0] : undefinedValue);
+            return jsi::Value::undefined();
+        }
+
+        instance_set_property_t setter;
+        const static_interface_data* iface;
+        size_t interface_index;
     };
 }
 
-jsi::Value projected_object_instance::get(jsi::Runtime& runtime, const jsi::PropNameID& id)
+jsi::Value runtime_class_data::get_function(jsi::Runtime& runtime, const jsi::PropNameID& id, const member_data& member)
 {
-    auto name = id.utf8(runtime);
-    if (auto itr = m_functions.find(name); itr != m_functions.end())
+    auto& functions = member.functions;
+    const void* key = nullptr;
+    if (functions.size() == 1)
+    {
+        key = functions[0].mapping;
+    }
+    else if (!functions.empty())
+    {
+        // NOTE: Data that is not in the class cache can get destroyed and its address reused by the data for some
+        // other class, so only overload sets of cached classes can be keyed by their 'member_data'
+        key = is_cached ? &member : nullptr;
+    }
+    else if (member.is_event_function)
+    {
+        // NOTE: These are the same for all classes, so use the address of the name as the key
+        key = (member.name == add_event_name) ? &add_event_name : &remove_event_name;
+    }
+    else
     {
-        return jsi::Value(runtime, itr->second);
+        return jsi::Value::undefined();
     }
 
-    sso_vector<const static_interface_data::function_mapping*> functions;
-    bool hasEvents = false;
-    for (auto iface : m_interfaces)
+    auto& cache = current_runtime_context()->function_cache;
+    if (key)
     {
-        if (auto itr = find_by_name(iface->properties, name); (itr != iface->properties.end()) && itr->getter)
+        if (auto itr = cache.find(key); itr != cache.end())
         {
-            return itr->getter(runtime, m_instance);
+            return jsi::Value(runtime, itr->second);
         }
+    }
 
-        if (auto dataItr = find_by_name(iface->functions, name); dataItr != iface->functions.end())
+    jsi::Function fn = [&]() {
+        if (functions.size() == 1)
         {
-            functions.push_back(&*dataItr);
-
-            // NOTE: Functions are sorted, so this should be the first of N consecutive functions with the same name
-            for (++dataItr; (dataItr != iface->functions.end()) && (dataItr->name == name); ++dataItr)
-            {
-                functions.push_back(&*dataItr);
-            }
+            // Non-overloaded function, or at least not overloaded with different arities
+            return jsi::Function::createFromHostFunction(
+                runtime, id, functions[0].mapping->arity, projected_function{ functions[0] });
+        }
+        else if (!functions.empty())
+        {
+            // TODO: Calculate max arity? Does it matter?
+            return jsi::Function::createFromHostFunction(runtime, id, 0, projected_overloaded_function{ functions });
         }
 
-        hasEvents = hasEvents || !iface->events.empty();
+        auto eventFn = (key == &add_event_name) ? &projected_object_instance::add_event_listener :
+                                                  &projected_object_instance::remove_event_listener;
+        return jsi::Function::createFromHostFunction(runtime, id, 2,
+            [eventFn](jsi::Runtime& runtime, const jsi::Value& thisVal, const jsi::Value* args, size_t count) {
+                auto obj = projected_object_instance::from_this(runtime, thisVal);
+                return (obj.get()->*eventFn)(runtime, args, count);
+            });
+    }();
+
+    if (!key)
+    {
+        return jsi::Value(std::move(fn));
     }
 
-    if (functions.size() > 1)
+    return jsi::Value(runtime, cache.emplace(key, std::move(fn)).first->second);
+}
+
+jsi::Object runtime_class_data::create_object(
+    jsi::Runtime& runtime, std::shared_ptr<projected_object_instance> instance)
+{
+    // NOTE: Creating a prototype only pays off if it gets shared by other instances, which requires the class data to
+    // be in the class cache
+    auto context = current_runtime_context();
+    if ((context->mode != projection_mode::prototype) || has_dynamic_properties || !is_cached)
     {
-        // Make sure there are no conflicts in arity. While this isn't technically 100% necessary, we still at least
-        // need to validate that default overloads are at the front of the list
-        // NOTE: The number of overloads should be pretty minimal, so doing this in a "selection sort-like" way should
-        // be fine
-        for (size_t i = 0; i < functions.size(); ++i)
+        return jsi::Object::createFromHostObject(runtime, std::move(instance));
+    }
+
+    if (!m_prototype)
+    {
+        m_prototype = create_prototype(runtime);
+    }
+
+    auto result = context->builtins.object_create(runtime).call(runtime, *m_prototype).asObject(runtime);
+    result.setNativeState(runtime, std::move(instance));
+    return result;
+}
+
+jsi::Object runtime_class_data::create_prototype(jsi::Runtime& runtime)
+{
+    auto& defineProperty = current_runtime_context()->builtins.object_define_property(runtime);
+
+    jsi::Object result(runtime);
+    std::unordered_set<std::string_view> definedNames;
+    auto define = [&](std::string_view name) {
+        // NOTE: Names can repeat (e.g. overloads or the same name on multiple interfaces), but the resolved member
+        // already accounts for all of them
+        if (!definedNames.insert(name).second)
         {
-            // NOTE: Even if the target is the default overload, we still want to remove other ones with the same arity
-            auto tgt = functions[i];
-            for (size_t j = i + 1; j < functions.size();)
-            {
-                auto test = functions[j];
-                if (tgt->arity == test->arity)
-                {
-                    if (!tgt->is_default_overload && test->is_default_overload)
-                    {
-                        // Use the other one
-                        tgt = test;
-                        functions[i] = test;
-                    }
+            return;
+        }
 
-                    functions[j] = functions.back();
-                    functions.pop_back();
-                    continue;
-                }
+        auto itr = m_members.find(std::string(name));
+        auto member = (itr != m_members.end()) ? &itr->second : resolve_member(name);
+        if (!member)
+        {
+            return;
+        }
 
-                ++j;
-            }
+        auto id = make_propid(runtime, name);
+        if (!member->getter && (!member->functions.empty() || member->is_event_function))
+        {
+            result.setProperty(runtime, id, get_function(runtime, id, *member));
+            return;
         }
-    }
 
-    if (functions.size() == 1)
+        // NOTE: Properties without a setter are read-only, so assigning to them throws in strict mode code, as it does
+        // for built-in accessors
+        jsi::Object descriptor(runtime);
+        if (member->getter)
+        {
+            descriptor.setProperty(runtime, "get",
+                jsi::Function::createFromHostFunction(runtime, id, 0,
+                    projected_property_getter{
+                        member->getter, interfaces[member->getter_interface], member->getter_interface }));
+        }
+
+        if (member->setter)
+        {
+            descriptor.setProperty(runtime, "set",
+                jsi::Function::createFromHostFunction(runtime, id, 1,
+                    projected_property_setter{
+                        member->setter, interfaces[member->setter_interface], member->setter_interface }));
+        }
+
+        descriptor.setProperty(runtime, "enumerable", true);
+        defineProperty.call(runtime, result, make_string(runtime, name), descriptor);
+    };
+
+    for (auto iface : interfaces)
     {
-        // Non-overloaded function, or at least not overloaded with different arities
-        auto fn =
-            jsi::Function::createFromHostFunction(runtime, id, functions[0]->arity, projected_function{ functions[0] });
-        return jsi::Value(runtime, m_functions.emplace(functions[0]->name, std::move(fn)).first->second);
+        for (auto&& prop : iface->properties)
+        {
+            define(prop.name);
+        }
+
+        for (auto&& func : iface->functions)
+        {
+            define(func.name);
+        }
     }
-    else if (!functions.empty())
+
+    if (has_events)
     {
-        // TODO: Calculate max arity? Does it matter?
-        auto functionName = functions[0]->name;
-        auto fn = jsi::Function::createFromHostFunction(
-            runtime, id, 0, projected_overloaded_function{ std::move(functions) });
-        return jsi::Value(runtime, m_functions.emplace(functionName, std::move(fn)).first->second);
+        define(add_event_name);
+        define(remove_event_name);
     }
 
-    if (hasEvents)
+    return result;
+}
+
+jsi::Value projected_object_instance::get(jsi::Runtime& runtime, const jsi::PropNameID& id)
+{
+    std::string name;
+    if (auto member = m_class->find_member(runtime, id, name))
     {
-        if (name == add_event_name)
+        if (member->getter)
         {
-            auto fn = bind_host_function(runtime, id, 2, &projected_object_instance::add_event_listener);
-            return jsi::Value(runtime, m_functions.emplace(add_event_name, std::move(fn)).first->second);
+            return member->getter(runtime, query_interface(member->getter_interface));
         }
-        else if (name == remove_event_name)
+
+        if (auto fn = m_class->get_function(runtime, id, *member); !fn.isUndefined())
+        {
+            return fn;
+        }
+
+        // Otherwise, this is a property with a setter, but no getter
+        if (name.empty())
         {
-            auto fn = bind_host_function(runtime, id, 2, &projected_object_instance::remove_event_listener);
-            return jsi::Value(runtime, m_functions.emplace(remove_event_name, std::move(fn)).first->second);
+            name = member->name;
         }
     }
 
     // If we've made it this far, check to see if any interface wants to handle the call (e.g. operator[] etc.)
     jsi::Value fallbackValue;
-    for (auto iface : m_interfaces)
+    auto& interfaces = m_class->interfaces;
+    for (size_t i = 0; i < interfaces.size(); ++i)
     {
-        if (!iface->runtime_get_property)
+        if (!interfaces[i]->runtime_get_property)
             continue;
 
-        auto [result, fallback] = iface->runtime_get_property(runtime, m_instance, name);
+        auto [result, fallback] = interfaces[i]->runtime_get_property(runtime, query_interface(i), name);
         if (result)
             return std::move(*result);
         else if (fallback)
@@ -688,23 +2088,29 @@ jsi::Value projected_object_instance::get(jsi::Runtime& runtime, const jsi::Prop
 
 void projected_object_instance::set(jsi::Runtime& runtime, const jsi::PropNameID& id, const jsi::Value& value)
 {
-    auto name = id.utf8(runtime);
-    for (auto iface : m_interfaces)
+    std::string name;
+    if (auto member = m_class->find_member(runtime, id, name))
     {
-        if (auto itr = find_by_name(iface->properties, name); (itr != iface->properties.end()) && itr->setter)
+        if (member->setter)
         {
-            itr->setter(runtime, m_instance, value);
+            member->setter(runtime, query_interface(member->setter_interface), value);
             return;
         }
+
+        if (name.empty())
+        {
+            name = member->name;
+        }
     }
 
     // If we've made it this far, check to see if any interface wants to handle the call (e.g. operator[] etc.)
-    for (auto iface : m_interfaces)
+    auto& interfaces = m_class->interfaces;
+    for (size_t i = 0; i < interfaces.size(); ++i)
     {
-        if (!iface->runtime_set_property)
+        if (!interfaces[i]->runtime_set_property)
             continue;
 
-        if (iface->runtime_set_property(runtime, m_instance, name, value))
+        if (interfaces[i]->runtime_set_property(runtime, query_interface(i), name, value))
             return;
     }
 
@@ -717,8 +2123,7 @@ std::vector<jsi::PropNameID> projected_object_instance::getPropertyNames(jsi::Ru
     // TODO: Since functions can be overloaded - and we don't collate them on interfaces like we do with classes - we
     // may end up with duplicates. Is that okay?
     std::vector<jsi::PropNameID> result;
-    bool hasEvents = false;
-    for (auto iface : m_interfaces)
+    for (auto iface : m_class->interfaces)
     {
         for (auto&& prop : iface->properties)
         {
@@ -729,11 +2134,9 @@ std::vector<jsi::PropNameID> projected_object_instance::getPropertyNames(jsi::Ru
         {
             result.push_back(make_propid(runtime, func.name));
         }
-
-        hasEvents = hasEvents || !iface->events.empty();
     }
 
-    if (hasEvents)
+    if (m_class->has_events)
     {
         result.push_back(make_propid(runtime, add_event_name));
         result.push_back(make_propid(runtime, remove_event_name));
@@ -749,12 +2152,17 @@ jsi::Value projected_object_instance::add_event_listener(jsi::Runtime& runtime,
         throw jsi::JSError(runtime, "TypeError: addEventListener expects (at least) 2 arguments");
     }
 
+    event_listener_options_scope options(runtime, args, count);
+
     auto name = args[0].asString(runtime).utf8(runtime);
-    for (auto iface : m_interfaces)
+    auto hash = hash_name(name);
+    auto& interfaces = m_class->interfaces;
+    for (size_t i = 0; i < interfaces.size(); ++i)
     {
-        if (auto itr = find_by_name(iface->events, name); itr != iface->events.end())
+        auto iface = interfaces[i];
+        if (auto itr = find_by_name(iface->events, iface->indices.events, name, hash); itr != iface->events.end())
         {
-            auto token = itr->add(runtime, m_instance, args[1]);
+            auto token = itr->add(runtime, query_interface(i), args[1]);
             current_runtime_context()->event_cache.add(m_instance, args[1].asObject(runtime), itr->name.data(), token);
             break;
         }
@@ -771,14 +2179,17 @@ jsi::Value projected_object_instance::remove_event_listener(jsi::Runtime& runtim
     }
 
     auto name = args[0].asString(runtime).utf8(runtime);
-    for (auto iface : m_interfaces)
+    auto hash = hash_name(name);
+    auto& interfaces = m_class->interfaces;
+    for (size_t i = 0; i < interfaces.size(); ++i)
     {
-        if (auto itr = find_by_name(iface->events, name); itr != iface->events.end())
+        auto iface = interfaces[i];
+        if (auto itr = find_by_name(iface->events, iface->indices.events, name, hash); itr != iface->events.end())
         {
             // TODO: Should we just no-op if the token can't be found?
             auto token = current_runtime_context()->event_cache.remove(
                 runtime, m_instance, args[1].asObject(runtime), itr->name.data());
-            itr->remove(m_instance, token);
+            itr->remove(query_interface(i), token);
             break;
         }
     }
@@ -817,42 +2228,61 @@ char16_t projected_value_traits<char16_t>::as_native(jsi::Runtime& runtime, cons
 
 winrt::hstring projected_value_traits<winrt::hstring>::as_native(jsi::Runtime& runtime, const jsi::Value& value)
 {
+#if RNWINRT_JSI_HAS_UTF16
+    auto str = value.asString(runtime).utf16(runtime);
+    return winrt::hstring(reinterpret_cast<const wchar_t*>(str.data()), static_cast<uint32_t>(str.size()));
+#else
     auto str = value.asString(runtime).utf8(runtime);
     if (str.empty())
     {
         return {};
     }
 
-    // MultiByteToWideChar is requesting the size in wide characters required for 'stringUtf8' without null
-    // termination as WindowsPreallocateStringBuffer will actually allocated 'outputLength + 1' characters and asign
-    // the last as the null terminator automatically.
-
-    auto len = ::MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, str.c_str(), static_cast<int32_t>(str.size()),
-        nullptr /*lpWideCharStr*/, 0 /*cchWideChar*/);
-    winrt::check_bool(len);
-
+    // Optimistically assume that the string is ASCII, in which case the lengths are the same and we can write straight
+    // into the HSTRING's buffer. Note that WindowsPreallocateStringBuffer allocates 'length + 1' characters and assigns
+    // the last as the null terminator automatically
     PWSTR stringBuffer;
     HSTRING_BUFFER buffer;
-    winrt::check_hresult(::WindowsPreallocateStringBuffer(static_cast<uint32_t>(len), &stringBuffer, &buffer));
+    winrt::check_hresult(::WindowsPreallocateStringBuffer(static_cast<uint32_t>(str.size()), &stringBuffer, &buffer));
 
     // NOTE: WindowsPreallocateStringBuffer will only give back null if the string is empty, however we've already
     // covered that case
     _Analysis_assume_(buffer != nullptr);
 
-    winrt::hstring result;
-    try
+    auto ascii = widen_ascii_prefix(str.data(), str.size(), stringBuffer);
+    if (ascii == str.size())
     {
-        winrt::check_bool(::MultiByteToWideChar(
-            CP_UTF8, MB_ERR_INVALID_CHARS, str.c_str(), static_cast<int32_t>(str.size()), stringBuffer, len));
-        winrt::check_hresult(::WindowsPromoteStringBuffer(buffer, reinterpret_cast<HSTRING*>(winrt::put_abi(result))));
+        winrt::hstring result;
+        if (auto hr = ::WindowsPromoteStringBuffer(buffer, reinterpret_cast<HSTRING*>(winrt::put_abi(result)));
+            FAILED(hr))
+        {
+            ::WindowsDeleteStringBuffer(buffer);
+            winrt::throw_hresult(hr);
+        }
+
+        return result;
     }
-    catch (...)
+
+    // Transcode the rest of the string in place after the ASCII prefix. A non-ASCII character always takes more bytes
+    // in UTF-8 than code units in UTF-16, so the result is shorter than the preallocated length, which can't be
+    // changed. The final HSTRING therefore gets created from the buffer with the exact length
+    auto remaining = static_cast<int32_t>(str.size() - ascii);
+    auto len = ::MultiByteToWideChar(
+        CP_UTF8, MB_ERR_INVALID_CHARS, str.data() + ascii, remaining, stringBuffer + ascii, remaining);
+    if (!len)
     {
+        auto hr = HRESULT_FROM_WIN32(::GetLastError());
         ::WindowsDeleteStringBuffer(buffer);
-        throw;
+        winrt::throw_hresult(hr);
     }
 
+    winrt::hstring result;
+    auto hr = ::WindowsCreateString(
+        stringBuffer, static_cast<uint32_t>(ascii + len), reinterpret_cast<HSTRING*>(winrt::put_abi(result)));
+    ::WindowsDeleteStringBuffer(buffer);
+    winrt::check_hresult(hr);
     return result;
+#endif
 }
 
 // Lengths are not null-terminated.
@@ -906,9 +2336,8 @@ jsi::Value projected_value_traits<winrt::DateTime>::as_value(jsi::Runtime& runti
 {
     auto unixTime =
         std::chrono::duration_cast<std::chrono::milliseconds>(value.time_since_epoch() - windows_to_unix_epoch_delta);
-    return runtime.global()
-        .getPropertyAsFunction(runtime, "Date")
-        .callAsConstructor(runtime, static_cast<double>(unixTime.count()));
+    return current_runtime_context()->builtins.date(runtime).callAsConstructor(
+        runtime, static_cast<double>(unixTime.count()));
 }
 
 winrt::DateTime projected_value_traits<winrt::DateTime>::as_native(jsi::Runtime& runtime, const jsi::Value& value)
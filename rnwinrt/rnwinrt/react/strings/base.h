@@ -12,6 +12,7 @@
 #endif
 
 #include <WeakReference.h>
+#include <array>
 #include <atomic>
 #include <charconv>
 #include <jsi/jsi.h>
@@ -22,6 +23,22 @@
 #include <vector>
 #include <winrt/Windows.Foundation.Collections.h>
 #include <winrt/Windows.Foundation.h>
+#include <winrt/Windows.Storage.Streams.h>
+
+// UTF-16 string creation and access was added to JSI in version 19. With older versions, strings can only be
+// transferred as UTF-8 and must be transcoded
+#if defined(JSI_VERSION) && (JSI_VERSION >= 19)
+#define RNWINRT_JSI_HAS_UTF16 1
+#else
+#define RNWINRT_JSI_HAS_UTF16 0
+#endif
+
+// Creating an ArrayBuffer over memory owned by native code ('jsi::MutableBuffer') was added to JSI in version 9
+#if defined(JSI_VERSION) && (JSI_VERSION >= 9)
+#define RNWINRT_JSI_HAS_MUTABLE_BUFFER 1
+#else
+#define RNWINRT_JSI_HAS_MUTABLE_BUFFER 0
+#endif
 
 // Common helpers/types
 namespace rnwinrt
@@ -526,6 +543,116 @@ namespace rnwinrt
         TLambda m_lambda;
     };
 
+    // A move-only, type-erased 'void()' callable, used for the callbacks that get marshalled to the JS thread (see
+    // 'runtime_context'). Unlike std::function, it does not require the callable to be copyable, and callables of up to
+    // 'inline_size' bytes, which covers the captures used by async completions and event delivery, are stored without
+    // allocating
+    struct task
+    {
+        static constexpr std::size_t inline_size = 6 * sizeof(void*);
+
+        task() noexcept = default;
+
+        template <typename Func, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Func>, task>>>
+        task(Func&& func)
+        {
+            using T = std::decay_t<Func>;
+            if constexpr (fits_inline<T>)
+            {
+                new (&m_storage) T(std::forward<Func>(func));
+                m_operations = &inline_operations<T>;
+            }
+            else
+            {
+                *reinterpret_cast<T**>(&m_storage) = new T(std::forward<Func>(func));
+                m_operations = &heap_operations<T>;
+            }
+        }
+
+        task(task&& other) noexcept
+        {
+            move_from(other);
+        }
+
+        task& operator=(task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                move_from(other);
+            }
+
+            return *this;
+        }
+
+        ~task()
+        {
+            reset();
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return m_operations != nullptr;
+        }
+
+        void operator()()
+        {
+            assert(m_operations);
+            m_operations->invoke(&m_storage);
+        }
+
+        void reset() noexcept
+        {
+            if (auto ops = std::exchange(m_operations, nullptr))
+            {
+                ops->destroy(&m_storage);
+            }
+        }
+
+    private:
+        struct operations
+        {
+            void (*invoke)(void* storage);
+            void (*move)(void* from, void* to) noexcept; // Also destroys the source
+            void (*destroy)(void* storage) noexcept;
+        };
+
+        template <typename T>
+        static constexpr bool fits_inline = (sizeof(T) <= inline_size) &&
+                                            (alignof(T) <= alignof(std::max_align_t)) &&
+                                            std::is_nothrow_move_constructible_v<T>;
+
+        template <typename T>
+        static constexpr operations inline_operations = {
+            [](void* storage) { (*static_cast<T*>(storage))(); },
+            [](void* from, void* to) noexcept {
+                auto source = static_cast<T*>(from);
+                new (to) T(std::move(*source));
+                source->~T();
+            },
+            [](void* storage) noexcept { static_cast<T*>(storage)->~T(); },
+        };
+
+        template <typename T>
+        static constexpr operations heap_operations = {
+            [](void* storage) { (**static_cast<T**>(storage))(); },
+            [](void* from, void* to) noexcept { *static_cast<T**>(to) = *static_cast<T**>(from); },
+            [](void* storage) noexcept { delete *static_cast<T**>(storage); },
+        };
+
+        void move_from(task& other) noexcept
+        {
+            if (auto ops = std::exchange(other.m_operations, nullptr))
+            {
+                ops->move(&other.m_storage, &m_storage);
+                m_operations = ops;
+            }
+        }
+
+        const operations* m_operations = nullptr;
+        std::aligned_storage_t<inline_size, alignof(std::max_align_t)> m_storage;
+    };
+
     template <typename T, typename U, typename Return, typename... Args>
     auto bind_this(Return (U::*fn)(Args...), T* pThis)
     {
@@ -566,18 +693,43 @@ namespace rnwinrt
     using static_add_event_t = winrt::event_token (*)(jsi::Runtime&, const jsi::Value&);
     using static_remove_event_t = void (*)(winrt::event_token);
 
-    using instance_get_property_t = jsi::Value (*)(jsi::Runtime&, const winrt::Windows::Foundation::IInspectable&);
-    using instance_set_property_t = void (*)(
-        jsi::Runtime&, const winrt::Windows::Foundation::IInspectable&, const jsi::Value&);
-    using instance_add_event_t = winrt::event_token (*)(
-        jsi::Runtime&, const winrt::Windows::Foundation::IInspectable&, const jsi::Value&);
-    using instance_remove_event_t = void (*)(const winrt::Windows::Foundation::IInspectable&, winrt::event_token);
-    using instance_call_function_t = jsi::Value (*)(
-        jsi::Runtime&, const winrt::Windows::Foundation::IInspectable&, const jsi::Value*);
+    // An object that has been queried for one of its interfaces, which is what the 'instance_*_t' functions below get
+    // called with. Only 'projected_object_instance::query_interface' creates these, and it does so for the interface
+    // that the function was generated for. This is what lets the functions use 'interface_cast' to reinterpret the
+    // object as that interface rather than making a QueryInterface call of their own
+    class queried_interface
+    {
+        friend struct projected_object_instance;
+
+        template <typename T>
+        friend const T& interface_cast(const queried_interface& value) noexcept;
+
+        queried_interface(const winrt::Windows::Foundation::IInspectable& value, const winrt::guid& iid) noexcept :
+            m_value(value), m_iid(iid)
+        {
+        }
+
+        const winrt::Windows::Foundation::IInspectable& m_value;
+        const winrt::guid& m_iid;
+    };
+
+    template <typename T>
+    const T& interface_cast(const queried_interface& value) noexcept
+    {
+        static_assert(sizeof(T) == sizeof(winrt::Windows::Foundation::IInspectable));
+        assert(winrt::guid_of<T>() == value.m_iid);
+        return reinterpret_cast<const T&>(value.m_value);
+    }
+
+    using instance_get_property_t = jsi::Value (*)(jsi::Runtime&, const queried_interface&);
+    using instance_set_property_t = void (*)(jsi::Runtime&, const queried_interface&, const jsi::Value&);
+    using instance_add_event_t = winrt::event_token (*)(jsi::Runtime&, const queried_interface&, const jsi::Value&);
+    using instance_remove_event_t = void (*)(const queried_interface&, winrt::event_token);
+    using instance_call_function_t = jsi::Value (*)(jsi::Runtime&, const queried_interface&, const jsi::Value*);
     using instance_runtime_get_property_t = std::pair<std::optional<jsi::Value>, std::optional<jsi::Value>> (*)(
-        jsi::Runtime&, const winrt::Windows::Foundation::IInspectable&, std::string_view);
+        jsi::Runtime&, const queried_interface&, std::string_view);
     using instance_runtime_set_property_t = bool (*)(
-        jsi::Runtime&, const winrt::Windows::Foundation::IInspectable&, std::string_view, const jsi::Value&);
+        jsi::Runtime&, const queried_interface&, std::string_view, const jsi::Value&);
 
     inline constexpr std::string_view add_event_name = "addEventListener"sv;
     inline constexpr std::string_view remove_event_name = "removeEventListener"sv;
@@ -862,6 +1014,10 @@ namespace rnwinrt
         static constexpr bool is_iterable = false;
         static constexpr bool is_vector_view = false;
         static constexpr bool is_vector = false;
+
+        static constexpr bool is_map_convertible = false;
+        static constexpr bool is_map_view = false;
+        static constexpr bool is_map = false;
     };
 
     template <typename T>
@@ -923,29 +1079,28 @@ namespace rnwinrt
         static constexpr bool is_vector = true;
     };
 
-    struct promise_wrapper
+    // NOTE: Only maps with string keys can be created from JS objects
+    template <typename K, typename V>
+    struct pinterface_traits<winrt::Windows::Foundation::Collections::IMapView<K, V>> : pinterface_traits_base
     {
-        static promise_wrapper create(jsi::Runtime& runtime)
-        {
-            // NOTE: The promise callback is called immediately, hence the capture by reference
-            std::optional<jsi::Function> resolveFn, rejectFn;
-            auto callback = jsi::Function::createFromHostFunction(runtime, make_propid(runtime, "callback"), 2,
-                [&](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args, size_t count) {
-                    if (count < 2)
-                    {
-                        throw jsi::JSError(runtime, "Promise callback unexpectedly called with insufficient arguments");
-                    }
+        using key_type = K;
+        using value_type = V;
+        static constexpr bool is_map_convertible = std::is_same_v<K, winrt::hstring>;
+        static constexpr bool is_map_view = true;
+    };
 
-                    resolveFn = args[0].asObject(runtime).asFunction(runtime);
-                    rejectFn = args[1].asObject(runtime).asFunction(runtime);
-                    return jsi::Value::undefined();
-                });
+    template <typename K, typename V>
+    struct pinterface_traits<winrt::Windows::Foundation::Collections::IMap<K, V>> : pinterface_traits_base
+    {
+        using key_type = K;
+        using value_type = V;
+        static constexpr bool is_map_convertible = std::is_same_v<K, winrt::hstring>;
+        static constexpr bool is_map = true;
+    };
 
-            auto promise =
-                runtime.global().getPropertyAsFunction(runtime, "Promise").callAsConstructor(runtime, callback);
-            assert(resolveFn && rejectFn);
-            return promise_wrapper(std::move(promise), std::move(*resolveFn), std::move(*rejectFn));
-        }
+    struct promise_wrapper
+    {
+        static promise_wrapper create(jsi::Runtime& runtime);
 
         const jsi::Value& get() const noexcept
         {
@@ -1100,6 +1255,8 @@ namespace rnwinrt
     // TODO: Figure out a good interval for performing cleanup
     static constexpr auto cleanup_interval = 5min;
 
+    struct projected_object_instance;
+
     struct object_instance_cache
     {
         // Maps an IInspectable pointer to the HostObject that represents that object. Note that it is possible for a
@@ -1107,7 +1264,7 @@ namespace rnwinrt
         // HostObject holds a strong reference to the WinRT object and therefore the WinRT object getting destroyed
         // would therefore imply that the JS object also got destroyed, meaning we won't accidentally re-use the same
         // HostObject after its underlying object got destroyed
-        std::unordered_map<void*, std::variant<jsi::WeakObject, std::weak_ptr<jsi::HostObject>>> instances;
+        std::unordered_map<void*, std::variant<jsi::WeakObject, std::weak_ptr<projected_object_instance>>> instances;
 
         // TODO: This is kind of a hack/workaround for V8, which does not appear to have WeakObject support per
         // V8Runtime::createWeakObject/V8Runtime::lockWeakObject
@@ -1118,7 +1275,10 @@ namespace rnwinrt
         // occasionally when we're querying for object instances
         std::chrono::steady_clock::time_point last_cleanup = std::chrono::steady_clock::now();
 
-        jsi::Value get_instance(jsi::Runtime& runtime, const winrt::Windows::Foundation::IInspectable& value);
+        // NOTE: When 'unboxPropertyValues' is true, instances of classes that implement IPropertyValue are converted to
+        // their corresponding JS value where possible
+        jsi::Value get_instance(jsi::Runtime& runtime, const winrt::Windows::Foundation::IInspectable& value,
+            bool unboxPropertyValues = false);
 
         void cleanup(jsi::Runtime& runtime)
         {
@@ -1193,6 +1353,46 @@ namespace rnwinrt
         }
     };
 
+    // Recently used property names of string-keyed maps (e.g. 'PropertySet') converted to the keys they get looked up
+    // with. Code tends to access the same few keys of a map repeatedly, so this saves converting the name to an HSTRING
+    // on every access. Each name maps to a single slot, and names are compared against the cached keys themselves, so a
+    // miss costs a hash and a single comparison on top of the conversion that would have been made anyway
+    struct map_key_cache
+    {
+        winrt::hstring get(std::string_view name)
+        {
+            auto& key = m_keys[std::hash<std::string_view>{}(name) % m_keys.size()];
+            if (!equals_ascii(key, name))
+            {
+                key = winrt::to_hstring(name);
+            }
+
+            return key;
+        }
+
+    private:
+        // NOTE: Keys with non-ASCII characters never compare equal, so such names get converted on every access
+        static bool equals_ascii(const winrt::hstring& key, std::string_view name) noexcept
+        {
+            if (key.size() != name.size())
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i < name.size(); ++i)
+            {
+                if ((key[i] >= 0x80) || (key[i] != static_cast<wchar_t>(name[i])))
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        std::array<winrt::hstring, 16> m_keys;
+    };
+
     struct object_event_cache
     {
         // NOTE: Since we currently hold strong references to the function objects being used as delegates, and just
@@ -1362,6 +1562,268 @@ namespace rnwinrt
         }
     };
 
+    // A multi-producer, single-consumer queue of callbacks. Producers push onto a lock-free intrusive stack and the
+    // consumer takes the whole stack at once. This lets 'runtime_context' schedule a single JS thread task for any
+    // number of callbacks, since a new task is only needed when a push transitions the queue from empty to non-empty
+    struct callback_queue
+    {
+        callback_queue() = default;
+
+        callback_queue(const callback_queue&) = delete;
+        callback_queue& operator=(const callback_queue&) = delete;
+
+        ~callback_queue()
+        {
+            clear();
+        }
+
+        // Returns true if the queue was empty, in which case the caller is responsible for arranging a call to 'drain'
+        bool push(task fn)
+        {
+            auto entry = new node{ std::move(fn), m_head.load(std::memory_order_relaxed) };
+            while (!m_head.compare_exchange_weak(
+                entry->next, entry, std::memory_order_release, std::memory_order_relaxed))
+            {
+            }
+
+            return entry->next == nullptr;
+        }
+
+        // Runs the callbacks that have been pushed so far, in the order they were pushed, and returns the number of
+        // callbacks run. Callbacks pushed while draining are left for the next call. If a callback throws, the
+        // remaining callbacks still run and the first exception is rethrown at the end
+        std::size_t drain()
+        {
+            // NOTE: The stack is in LIFO order
+            node* list = nullptr;
+            for (auto entry = m_head.exchange(nullptr, std::memory_order_acquire); entry;)
+            {
+                auto next = entry->next;
+                entry->next = list;
+                list = entry;
+                entry = next;
+            }
+
+            std::size_t count = 0;
+            std::exception_ptr exception;
+            while (list)
+            {
+                std::unique_ptr<node> entry(list);
+                list = list->next;
+                ++count;
+
+                try
+                {
+                    entry->callback();
+                }
+                catch (...)
+                {
+                    if (!exception)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+
+            if (exception)
+            {
+                std::rethrow_exception(exception);
+            }
+
+            return count;
+        }
+
+        // Destroys all queued callbacks without running them
+        void clear() noexcept
+        {
+            auto entry = m_head.exchange(nullptr, std::memory_order_acquire);
+            while (entry)
+            {
+                std::unique_ptr<node> current(entry);
+                entry = entry->next;
+            }
+        }
+
+    private:
+        struct node
+        {
+            task callback;
+            node* next;
+        };
+
+        std::atomic<node*> m_head{ nullptr };
+    };
+
+    struct runtime_class_data;
+
+    // How projected objects are represented in JS. Selected by the options passed to 'WinRTTurboModule::initialize'
+    enum class projection_mode
+    {
+        // Every object is a HostObject, which resolves members by name in its 'get' and 'set' functions
+        host_object,
+
+        // Objects are plain JS objects that hold the WinRT object as their NativeState and that share a single
+        // prototype per runtime class with accessor properties and methods. This allows the engine to apply its inline
+        // caching and shape optimizations to member access. Classes that implement interfaces with dynamic properties
+        // (e.g. indexing into an IVector) and objects whose class data is not cached (e.g. objects that don't report a
+        // class name) still get projected as HostObjects
+        prototype,
+    };
+
+    // How invocations of a delegate that was created from a JS function get delivered to the JS thread when the
+    // delegate is invoked from some other thread
+    enum class event_delivery
+    {
+        // The invoking thread waits for the JS function to complete. This is required for delegates that return a value
+        // or have out params, as well as for event handlers that need to complete their work before the event
+        // source continues (e.g. when using deferrals)
+        sync,
+
+        // The invocation is queued to the JS thread and the invoking thread continues immediately. Only applies to
+        // delegates that have no return value, no out params, and no array params; all others are always synchronous
+        async,
+    };
+
+    // Options for the delegates that get created from JS functions. Set from the options passed to 'addEventListener'
+    struct event_options
+    {
+        event_delivery delivery = event_delivery::sync;
+
+        // Only used with 'async' delivery. When set, an invocation that has not yet reached the JS thread is dropped
+        // when the delegate gets invoked again, so at most one invocation (i.e. the most recent) is pending at a time
+        bool latest_only = false;
+
+        // Only used with 'async' delivery. When non-zero, implies 'latest_only' and additionally delivers at most one
+        // invocation per interval
+        std::chrono::milliseconds throttle{ 0 };
+    };
+
+    // The JS typed arrays that arrays of primitive WinRT types can be projected as. Note that there's intentionally no
+    // mapping for 64-bit integers, since those are otherwise projected as numbers and not BigInts, nor for 'bool' or
+    // 'char16_t'
+    enum class typed_array_type
+    {
+        uint8,
+        int16,
+        uint16,
+        int32,
+        uint32,
+        float32,
+        float64,
+    };
+
+    inline constexpr std::size_t typed_array_type_count = 7;
+
+    template <typename T>
+    struct typed_array_traits
+    {
+        static constexpr bool is_supported = false;
+    };
+
+    template <typed_array_type Type>
+    struct typed_array_traits_base
+    {
+        static constexpr bool is_supported = true;
+        static constexpr typed_array_type type = Type;
+    };
+
+    template <>
+    struct typed_array_traits<uint8_t> : typed_array_traits_base<typed_array_type::uint8>
+    {
+    };
+
+    template <>
+    struct typed_array_traits<int16_t> : typed_array_traits_base<typed_array_type::int16>
+    {
+    };
+
+    template <>
+    struct typed_array_traits<uint16_t> : typed_array_traits_base<typed_array_type::uint16>
+    {
+    };
+
+    template <>
+    struct typed_array_traits<int32_t> : typed_array_traits_base<typed_array_type::int32>
+    {
+    };
+
+    template <>
+    struct typed_array_traits<uint32_t> : typed_array_traits_base<typed_array_type::uint32>
+    {
+    };
+
+    template <>
+    struct typed_array_traits<float> : typed_array_traits_base<typed_array_type::float32>
+    {
+    };
+
+    template <>
+    struct typed_array_traits<double> : typed_array_traits_base<typed_array_type::float64>
+    {
+    };
+
+    // Handles to the JS builtins used when marshalling values, so that hot paths don't need to look them up from the
+    // global object every time. Each is looked up the first time it is used
+    struct builtin_cache
+    {
+        const jsi::Function& date(jsi::Runtime& runtime);
+        const jsi::Function& promise(jsi::Runtime& runtime);
+        const jsi::Function& promise_then(jsi::Runtime& runtime);
+        const jsi::Function& promise_finally(jsi::Runtime& runtime);
+        const jsi::Object& array_prototype(jsi::Runtime& runtime);
+        const jsi::Function& array_push(jsi::Runtime& runtime);
+        const jsi::Function& array_splice(jsi::Runtime& runtime);
+        const jsi::Function& array_pop(jsi::Runtime& runtime);
+        const jsi::Function& array_from(jsi::Runtime& runtime);
+        const jsi::Function& object_create(jsi::Runtime& runtime);
+        const jsi::Function& object_define_property(jsi::Runtime& runtime);
+        const jsi::Function& object_has_own_property(jsi::Runtime& runtime);
+        const jsi::Function& object_keys(jsi::Runtime& runtime);
+        const jsi::Function& array_buffer(jsi::Runtime& runtime);
+        const jsi::Function& array_buffer_is_view(jsi::Runtime& runtime);
+        const jsi::Function& map(jsi::Runtime& runtime);
+        const jsi::Function& reflect_delete_property(jsi::Runtime& runtime);
+        const jsi::Function& typed_array(jsi::Runtime& runtime, typed_array_type type);
+
+        // Releases all handles. Called when the runtime goes away (e.g. on reload) since they are only valid for the
+        // runtime that they were looked up from
+        void clear() noexcept;
+
+    private:
+        std::optional<jsi::Function> m_date;
+        std::optional<jsi::Function> m_promise;
+        std::optional<jsi::Function> m_promiseThen;
+        std::optional<jsi::Function> m_promiseFinally;
+        std::optional<jsi::Object> m_arrayPrototype;
+        std::optional<jsi::Function> m_arrayPush;
+        std::optional<jsi::Function> m_arraySplice;
+        std::optional<jsi::Function> m_arrayPop;
+        std::optional<jsi::Function> m_arrayFrom;
+        std::optional<jsi::Function> m_objectCreate;
+        std::optional<jsi::Function> m_objectDefineProperty;
+        std::optional<jsi::Function> m_objectHasOwnProperty;
+        std::optional<jsi::Function> m_objectKeys;
+        std::optional<jsi::Function> m_arrayBuffer;
+        std::optional<jsi::Function> m_arrayBufferIsView;
+        std::optional<jsi::Function> m_map;
+        std::optional<jsi::Function> m_reflectDeleteProperty;
+        std::optional<jsi::Function> m_typedArrays[typed_array_type_count];
+    };
+
+    // Counters that are useful for diagnosing the performance of the projection. Exposed to JS through the module's
+    // 'getStatistics' function
+    struct runtime_statistics
+    {
+        // Number of member lookups on projected object instances and how many of those were satisfied by an already
+        // resolved entry in the per-class member table
+        uint64_t member_lookups = 0;
+        uint64_t member_table_hits = 0;
+
+        // Number of callbacks marshalled to the JS thread and the number of JS thread tasks used to run them
+        uint64_t queued_callbacks = 0;
+        uint64_t queue_drains = 0;
+    };
+
     struct runtime_context
     {
         jsi::Runtime& runtime;
@@ -1373,12 +1835,59 @@ namespace rnwinrt
         object_instance_cache instance_cache;
         object_event_cache event_cache;
 
+        // Data shared by all instances of the same runtime class, keyed by the class name. Entries are never removed
+        // since the number of distinct runtime classes that get projected is bounded
+        std::unordered_map<winrt::hstring, std::shared_ptr<runtime_class_data>> class_cache;
+
+        // Host functions for the methods of projected objects. These resolve the target object from 'this' when called,
+        // so a single function object is shared by all instances. Non-overloaded functions are keyed by their
+        // 'function_mapping' and are therefore also shared across classes that implement the same interface. Overload
+        // sets are keyed by the class' 'member_data' since the set of overloads depends on the class' interfaces. The
+        // overload sets of classes that are not in 'class_cache' are not cached
+        std::unordered_map<const void*, jsi::Value> function_cache;
+
+        map_key_cache map_keys;
+
+        runtime_statistics statistics;
+
+        projection_mode mode = projection_mode::host_object;
+
+        // When true, arrays of primitive types that are returned from WinRT are projected as typed arrays (e.g.
+        // 'Uint8Array') instead of JS arrays. Selected by the options passed to 'WinRTTurboModule::initialize'
+        bool typed_arrays = false;
+
+        // When true, 'IBuffer' values that are returned from WinRT are projected as ArrayBuffers that share memory with
+        // the native buffer instead of as projected objects. Selected by the options passed to
+        // 'WinRTTurboModule::initialize'
+        bool buffers_as_array_buffers = false;
+
+        // The delivery used by listeners added via 'addEventListener' when they don't specify one themselves. Selected
+        // by the options passed to 'WinRTTurboModule::initialize'
+        event_delivery default_event_delivery = event_delivery::sync;
+
+        // The options used by delegates as they get created from JS functions. These are the defaults (i.e. 'sync'
+        // delivery) except for the duration of 'addEventListener' calls, so delegates passed as function arguments are
+        // unaffected by the above
+        event_options delegate_options;
+
+        // The minimum time between two progress reports of the same async operation being delivered to JS. Progress
+        // reports are always coalesced such that only the most recent one is delivered, regardless of this value.
+        // Selected by the options passed to 'WinRTTurboModule::initialize'
+        std::chrono::milliseconds progress_throttle{ 0 };
+
+        // The maximum number of elements read from a collection with a single 'GetMany' call when iterating it (e.g.
+        // by 'forEach', 'map', 'slice', etc.). Larger chunks mean fewer ABI calls at the cost of more memory. Selected
+        // by the options passed to 'WinRTTurboModule::initialize'
+        uint32_t collection_chunk_size = 1024;
+
+        builtin_cache builtins;
+
         runtime_context(jsi::Runtime& runtime, std::function<void(std::function<void()>)> callInvoker) :
             runtime(runtime), call_invoker(callInvoker)
         {
         }
 
-        void call(std::function<void()> fn) const
+        void call(task fn) const
         {
             if (thread_id == std::this_thread::get_id())
             {
@@ -1386,16 +1895,24 @@ namespace rnwinrt
             }
             else
             {
-                call_invoker(std::move(fn));
+                post(std::move(fn));
             }
         }
 
-        void call_async(std::function<void()> fn) const
+        void call_async(task fn) const
+        {
+            post(std::move(fn));
+        }
+
+        template <typename Func>
+        void call_sync(Func&& fn) const
         {
-            call_invoker(std::move(fn));
+            // NOTE: 'fn' is always invoked before 'call_sync' returns, so the task only needs to reference it. This
+            // keeps the task small enough to be stored inline, regardless of how much state 'fn' captures
+            call_sync_impl([&fn]() { fn(); });
         }
 
-        void call_sync(std::function<void()> fn) const
+        __declspec(noinline) void call_sync_impl(task fn) const
         {
             if (thread_id == std::this_thread::get_id())
             {
@@ -1403,36 +1920,41 @@ namespace rnwinrt
             }
             else
             {
-                winrt::handle event(::CreateEventW(nullptr, true, false, nullptr));
-                if (!event.get())
-                {
-                    winrt::throw_last_error();
-                }
-
-                lifetime_tracker tracker([&] { ::SetEvent(event.get()); });
+                auto event = sync_event();
+                lifetime_tracker tracker([&] { ::SetEvent(event); });
 
                 std::exception_ptr exception;
                 bool invoked = false;
-                call_invoker([&, ref = tracker.begin()]() mutable {
-                    // Force the completion of the event once the callback completes so we don't need to wait for the
-                    // lambda to be destroyed if for some reason it isn't immediate. Note that this sets the callback
-                    // pointer to null, so there's no dangling reference anywhere
-                    auto forceComplete = std::move(ref);
-                    assert(tracker.ref_count.load(std::memory_order_relaxed) == 1);
-
-                    try
-                    {
-                        fn();
-                    }
-                    catch (...)
-                    {
-                        exception = std::current_exception();
-                    }
+                try
+                {
+                    post([&, ref = tracker.begin()]() mutable {
+                        // Force the completion of the event once the callback completes so we don't need to wait for
+                        // the lambda to be destroyed if for some reason it isn't immediate. Note that this sets the
+                        // callback pointer to null, so there's no dangling reference anywhere
+                        auto forceComplete = std::move(ref);
+                        assert(tracker.ref_count.load(std::memory_order_relaxed) == 1);
 
-                    invoked = true;
-                });
+                        try
+                        {
+                            fn();
+                        }
+                        catch (...)
+                        {
+                            exception = std::current_exception();
+                        }
+
+                        invoked = true;
+                    });
+                }
+                catch (...)
+                {
+                    // The callback was destroyed without running, which has already signaled the event. Consume the
+                    // signal so that the event can be reused
+                    ::WaitForSingleObject(event, INFINITE);
+                    throw;
+                }
 
-                if (::WaitForSingleObject(event.get(), INFINITE) != WAIT_OBJECT_0)
+                if (::WaitForSingleObject(event, INFINITE) != WAIT_OBJECT_0)
                 {
                     winrt::terminate();
                 }
@@ -1467,13 +1989,71 @@ namespace rnwinrt
                 delete this;
             }
         }
-    };
 
-    inline shared_runtime_context::shared_runtime_context(runtime_context* ptr) : pointer(ptr)
-    {
-        if (pointer)
+    private:
+        // The auto-reset event that 'call_sync' uses to wait for the JS thread. A thread only ever waits on a single
+        // call at a time, so the event is created on first use and then reused for the lifetime of the thread
+        static HANDLE sync_event()
         {
-            ++pointer->ref_count;
+            static thread_local winrt::handle event;
+            if (!event)
+            {
+                event.attach(::CreateEventW(nullptr, false, false, nullptr));
+                if (!event)
+                {
+                    winrt::throw_last_error();
+                }
+            }
+
+            return event.get();
+        }
+
+        // The JS thread task that runs the callbacks in 'm_queue'. If the invoker destroys the task without running it
+        // (e.g. because the runtime is being torn down), the queued callbacks are destroyed with it, which 'call_sync'
+        // relies on to detect callbacks that will never run
+        struct drain_task
+        {
+            shared_runtime_context context;
+
+            drain_task(runtime_context* ctxt) : context(ctxt)
+            {
+            }
+
+            drain_task(drain_task&&) = default;
+
+            ~drain_task()
+            {
+                if (context.pointer)
+                {
+                    context->m_queue.clear();
+                }
+            }
+
+            void operator()()
+            {
+                auto ctxt = std::move(context);
+                auto count = ctxt->m_queue.drain();
+                ctxt->statistics.queued_callbacks += count;
+                ++ctxt->statistics.queue_drains;
+            }
+        };
+
+        void post(task fn) const
+        {
+            if (m_queue.push(std::move(fn)))
+            {
+                call_invoker(move_only_lambda(drain_task{ const_cast<runtime_context*>(this) }));
+            }
+        }
+
+        mutable callback_queue m_queue;
+    };
+
+    inline shared_runtime_context::shared_runtime_context(runtime_context* ptr) : pointer(ptr)
+    {
+        if (pointer)
+        {
+            ++pointer->ref_count;
         }
     }
 
@@ -1505,11 +2085,113 @@ namespace rnwinrt
     }
 
     runtime_context* current_runtime_context();
+
+    // JSI values can only be released on the JS thread. Native objects that hold onto a JSI value (e.g. the function of
+    // a delegate) are often released by WinRT on some other thread, in which case this hands the value off to the JS
+    // thread. Intended to be called from the destructor of such objects
+    template <typename T>
+    void release_on_js_thread(const shared_runtime_context& context, T value)
+    {
+        if (context->thread_id != std::this_thread::get_id())
+        {
+            context->call_async([value = std::move(value)]() {});
+        }
+    }
+
+    // Marshals callbacks to the JS thread such that at most one is pending at any time; a callback that gets submitted
+    // while another is still pending replaces it. When 'throttle' is non-zero, callbacks are additionally delivered at
+    // most once per interval. Used for notifications where only the most recent one matters (e.g. sensor readings or
+    // progress). This object is shared with the callbacks that get queued to the JS thread, which is why the submitted
+    // callbacks should not hold strong references to the owner of this object
+    struct coalesced_callback : std::enable_shared_from_this<coalesced_callback>
+    {
+        coalesced_callback(shared_runtime_context context, std::chrono::milliseconds throttle) :
+            m_context(std::move(context)), m_throttle(throttle)
+        {
+        }
+
+        // Can be called from any thread
+        void submit(task callback);
+
+        // Must be called on the JS thread. Synchronously invokes the pending callback, if any, rather than waiting for
+        // its (possibly throttled) delivery; callbacks submitted afterwards are dropped
+        void close();
+
+    private:
+        void deliver();
+        static winrt::fire_and_forget deliver_after(
+            std::shared_ptr<coalesced_callback> self, std::chrono::steady_clock::duration delay);
+
+        shared_runtime_context m_context;
+        std::chrono::milliseconds m_throttle;
+
+        winrt::slim_mutex m_lock;
+        task m_pending;
+        bool m_scheduled = false;
+        bool m_closed = false;
+        std::chrono::steady_clock::time_point m_lastDelivery;
+    };
 }
 
 // Types used to store static data
 namespace rnwinrt
 {
+    // NOTE: Must be kept in-sync with the copy in ReactFileGenerator.cpp
+    constexpr std::uint32_t hash_name(std::string_view name) noexcept
+    {
+        // 32-bit FNV-1a
+        std::uint32_t hash = 2166136261u;
+        for (auto ch : name)
+        {
+            hash = (hash ^ static_cast<std::uint8_t>(ch)) * 16777619u;
+        }
+
+        return hash;
+    }
+
+    // A generated hash index over a table of names, used to avoid linear searches over large tables. 'hashes' holds
+    // the hash of each name in the table, in table order. 'buckets' has a power of two size and holds either zero
+    // (empty) or one plus the index of the first entry in the table with a given name; collisions use linear probing.
+    // Tables that are small, or that are not generated (e.g. the generic collection interfaces), have an empty index
+    struct static_name_index
+    {
+        span<const std::uint32_t> hashes;
+        span<const std::uint16_t> buckets;
+
+        bool empty() const noexcept
+        {
+            return buckets.empty();
+        }
+
+        // Returns the index of the first entry whose name has the given hash and that satisfies 'pred', or npos
+        template <typename Pred>
+        std::size_t find(std::uint32_t hash, Pred&& pred) const
+        {
+            auto mask = buckets.size() - 1;
+            for (auto pos = hash & mask;; pos = (pos + 1) & mask)
+            {
+                auto entry = buckets[pos];
+                if (entry == 0)
+                {
+                    return std::string_view::npos;
+                }
+
+                auto index = static_cast<std::size_t>(entry - 1);
+                if ((hashes[index] == hash) && pred(index))
+                {
+                    return index;
+                }
+            }
+        }
+    };
+
+    struct static_member_indices
+    {
+        static_name_index properties;
+        static_name_index events;
+        static_name_index functions;
+    };
+
     // NOTE: All of these instances are intended to go into the .text section and hold no state that needs to be free'd,
     // hence the lack of a virtual destructor
     struct static_projection_data
@@ -1525,14 +2207,17 @@ namespace rnwinrt
 
     struct static_namespace_data final : static_projection_data
     {
-        constexpr static_namespace_data(std::string_view name, span<const static_projection_data* const> children) :
-            static_projection_data(name), children(children)
+        constexpr static_namespace_data(std::string_view name, span<const static_projection_data* const> children,
+            static_name_index childrenIndex = {}) :
+            static_projection_data(name),
+            children(children), children_index(childrenIndex)
         {
         }
 
         virtual jsi::Value create(jsi::Runtime& runtime) const override;
 
         span<const static_projection_data* const> children;
+        static_name_index children_index;
     };
 
     struct static_enum_data final : static_projection_data
@@ -1546,8 +2231,10 @@ namespace rnwinrt
             std::string_view value_as_string;
         };
 
-        constexpr static_enum_data(std::string_view name, span<const value_mapping> values) :
-            static_projection_data(name), values(values)
+        constexpr static_enum_data(std::string_view name, span<const value_mapping> values,
+            static_name_index nameIndex = {}, static_name_index valueIndex = {}) :
+            static_projection_data(name),
+            values(values), name_index(nameIndex), value_index(valueIndex)
         {
         }
 
@@ -1556,6 +2243,8 @@ namespace rnwinrt
         jsi::Value get_value(jsi::Runtime& runtime, std::string_view valueName) const;
 
         span<const value_mapping> values;
+        static_name_index name_index; // Indexes 'value_mapping::name'
+        static_name_index value_index; // Indexes 'value_mapping::value_as_string'
     };
 
     extern const span<const static_namespace_data* const> root_namespaces;
@@ -1583,9 +2272,10 @@ namespace rnwinrt
         };
 
         constexpr static_class_data(std::string_view name, span<const property_mapping> properties,
-            span<const event_mapping> events, span<const function_mapping> functions) :
+            span<const event_mapping> events, span<const function_mapping> functions,
+            static_member_indices indices = {}) :
             static_projection_data(name),
-            properties(properties), events(events), functions(functions)
+            properties(properties), events(events), functions(functions), indices(indices)
         {
         }
 
@@ -1594,14 +2284,15 @@ namespace rnwinrt
         span<const property_mapping> properties;
         span<const event_mapping> events;
         span<const function_mapping> functions;
+        static_member_indices indices;
     };
 
     struct static_activatable_class_data final : static_class_data
     {
         constexpr static_activatable_class_data(std::string_view ns, std::string_view name, call_function_t constructor,
             span<const property_mapping> properties, span<const event_mapping> events,
-            span<const function_mapping> functions) :
-            static_class_data(name, properties, events, functions),
+            span<const function_mapping> functions, static_member_indices indices = {}) :
+            static_class_data(name, properties, events, functions, indices),
             full_namespace(ns), constructor(constructor)
         {
         }
@@ -1642,10 +2333,10 @@ namespace rnwinrt
         constexpr static_interface_data(const winrt::guid& guid, span<const property_mapping> properties,
             span<const event_mapping> events, span<const function_mapping> functions,
             instance_runtime_get_property_t runtimeGetProperty = nullptr,
-            instance_runtime_set_property_t runtimeSetProperty = nullptr) :
+            instance_runtime_set_property_t runtimeSetProperty = nullptr, static_member_indices indices = {}) :
             guid(guid),
             properties(properties), events(events), functions(functions), runtime_get_property(runtimeGetProperty),
-            runtime_set_property(runtimeSetProperty)
+            runtime_set_property(runtimeSetProperty), indices(indices)
         {
         }
 
@@ -1657,9 +2348,14 @@ namespace rnwinrt
         // Some projected types want the ability to expose functions beyond what's
         instance_runtime_get_property_t runtime_get_property;
         instance_runtime_set_property_t runtime_set_property;
+
+        static_member_indices indices;
     };
 
+    // NOTE: The map is ordered by slot in a generated minimal perfect hash table. The seeds are used to find the slot
+    // that corresponds to an IID; see 'find_interface' in base.cpp
     extern const span<const std::pair<winrt::guid, const static_interface_data*>> global_interface_map;
+    extern const span<const std::int32_t> global_interface_map_seeds;
 }
 
 // Types used for object instances, etc.
@@ -1717,15 +2413,94 @@ namespace rnwinrt
         event_registration_array m_events;
     };
 
-    struct projected_function;
-    struct projected_overloaded_function;
+    // Data shared by all instances of a single runtime class. The set of interfaces is resolved once, when the first
+    // instance of the class is created, and is immutable thereafter. Members are resolved from the static interface
+    // data the first time that they are looked up and the result is then re-used by all instances of the class
+    struct runtime_class_data
+    {
+        static std::shared_ptr<runtime_class_data> get(const winrt::Windows::Foundation::IInspectable& instance);
+
+        sso_vector<const static_interface_data*> interfaces;
+        bool has_events = false;
+        bool is_property_value = false;
+
+        // True if any interface handles names that are not in its static data (e.g. indices into an IVector), which
+        // can only be supported by a HostObject
+        bool has_dynamic_properties = false;
+
+        // The number and hash of the IIDs that the data was created from. Used to validate cache hits for objects
+        // that report an interface name as their class name
+        std::uint32_t iid_count = 0;
+        std::uint32_t iid_hash = 0;
+
+        // True if the data is in the runtime's 'class_cache' and therefore lives as long as the runtime context
+        bool is_cached = false;
+
+        struct function_data
+        {
+            const static_interface_data* iface;
+            const static_interface_data::function_mapping* mapping;
+            size_t interface_index; // The index of 'iface' in 'interfaces'
+        };
+
+        struct member_data
+        {
+            std::string_view name;
+
+            // NOTE: The getter and setter are resolved independently since they can come from different interfaces. The
+            // '*_interface' values are the indices of those interfaces in 'interfaces'
+            instance_get_property_t getter = nullptr;
+            instance_set_property_t setter = nullptr;
+            size_t getter_interface = 0;
+            size_t setter_interface = 0;
+
+            // Functions with this name, de-duplicated by arity with default overloads preferred
+            sso_vector<function_data, 4> functions;
+
+            // True for 'addEventListener' and 'removeEventListener' when the class has events
+            bool is_event_function = false;
+        };
+
+        // Returns null if the name does not correspond to a member in the static data, in which case the UTF-8 name is
+        // written to 'name' so that the caller can continue with the 'runtime_get_property' fallback. Otherwise, 'name'
+        // may not be populated
+        const member_data* find_member(jsi::Runtime& runtime, const jsi::PropNameID& id, std::string& name);
 
-    struct projected_object_instance : public jsi::HostObject
+        // Returns the shared function object for the member, or undefined if the member is not a function
+        jsi::Value get_function(jsi::Runtime& runtime, const jsi::PropNameID& id, const member_data& member);
+
+        // Creates the JS object for an instance of this class, as determined by the runtime's 'projection_mode'
+        jsi::Object create_object(jsi::Runtime& runtime, std::shared_ptr<projected_object_instance> instance);
+
+    private:
+        const member_data* resolve_member(std::string_view name);
+        jsi::Object create_prototype(jsi::Runtime& runtime);
+
+        struct recent_id
+        {
+            jsi::PropNameID id;
+            const member_data* member;
+        };
+
+        // Comparing two PropNameIDs is typically a pointer comparison for engines that intern property names, which
+        // lets the most frequently accessed members skip the UTF-8 conversion and hash lookup entirely
+        static constexpr size_t recent_ids_size = 8;
+        sso_vector<recent_id, recent_ids_size> m_recentIds;
+        size_t m_nextRecentId = 0;
+
+        std::unordered_map<std::string, member_data> m_members;
+
+        // Only used when the runtime's 'projection_mode' is 'prototype'; created along with the first instance
+        std::optional<jsi::Object> m_prototype;
+    };
+
+    // NOTE: This is a HostObject or the NativeState of a plain JS object, depending on the runtime's 'projection_mode'
+    struct projected_object_instance : public jsi::HostObject, public jsi::NativeState
     {
-        friend struct projected_function;
-        friend struct projected_overloaded_function;
+        friend struct runtime_class_data;
 
-        projected_object_instance(const winrt::Windows::Foundation::IInspectable& instance);
+        projected_object_instance(
+            const winrt::Windows::Foundation::IInspectable& instance, std::shared_ptr<runtime_class_data> classData);
 
         // HostObject functions
         virtual jsi::Value get(jsi::Runtime& runtime, const jsi::PropNameID& name) override;
@@ -1737,13 +2512,36 @@ namespace rnwinrt
             return m_instance;
         }
 
+        const std::shared_ptr<runtime_class_data>& class_data() const noexcept
+        {
+            return m_class;
+        }
+
+        // Returns null if 'object' is not a projected object instance
+        static std::shared_ptr<projected_object_instance> from_object(jsi::Runtime& runtime, const jsi::Object& object);
+
+        // Used by host functions to resolve their 'this' value. Throws a TypeError if it is not a projected object
+        static std::shared_ptr<projected_object_instance> from_this(jsi::Runtime& runtime, const jsi::Value& thisValue);
+
+        // Returns the instance queried for the interface at 'index' in the class' interface list. This is what the
+        // 'instance_*_t' functions in the static interface data expect to be called with. The result is cached, so
+        // only the first call for each interface makes a QueryInterface call
+        queried_interface query_interface(size_t index);
+
+        // Same as above, but for functions and accessors that can be called with an instance of any class, such as the
+        // shared function objects. 'index' is the index of 'iface' in the interface list of the class that these were
+        // retrieved from, which is almost always the class of this instance
+        queried_interface query_interface(const static_interface_data* iface, size_t index);
+
     private:
         jsi::Value add_event_listener(jsi::Runtime& runtime, const jsi::Value* args, size_t count);
         jsi::Value remove_event_listener(jsi::Runtime& runtime, const jsi::Value* args, size_t count);
 
         winrt::Windows::Foundation::IInspectable m_instance;
-        sso_vector<const static_interface_data*> m_interfaces;
-        std::unordered_map<std::string_view, jsi::Value> m_functions;
+        std::shared_ptr<runtime_class_data> m_class;
+
+        // Parallel to 'm_class->interfaces'; null until the interface is first needed
+        sso_vector<winrt::Windows::Foundation::IInspectable, 8> m_interfaces;
     };
 
     template <typename IFace>
@@ -1762,14 +2560,24 @@ namespace rnwinrt
         static std::shared_ptr<projected_async_instance> create(IFace instance)
         {
             auto result = std::make_shared<projected_async_instance>(std::move(instance), tag_t{});
+            if (result->try_complete_synchronously())
+            {
+                return result;
+            }
+
             result->initialize();
 
             if constexpr (traits::is_async_with_progress) // IAsync*WithProgress
             {
+                // NOTE: Only the most recent progress report gets delivered, so operations that report progress at a
+                // high rate don't flood the JS thread (and delay their own completion) with stale reports
+                auto ctxt = current_runtime_context();
+                result->m_progressCallback =
+                    std::make_shared<coalesced_callback>(ctxt->add_reference(), ctxt->progress_throttle);
                 result->m_instance.Progress(
-                    [weakThis = std::weak_ptr{ result }, ctxt = current_runtime_context()->add_reference()](
+                    [weakThis = std::weak_ptr{ result }, progressCallback = result->m_progressCallback](
                         const auto&, const auto& progress) {
-                        ctxt->call([progress, weakThis]() {
+                        progressCallback->submit([progress, weakThis]() {
                             if (auto strongThis = weakThis.lock())
                             {
                                 auto& runtime = current_runtime_context()->runtime;
@@ -1835,7 +2643,17 @@ namespace rnwinrt
             auto itr = std::find_if(getFns.begin(), getFns.end(), [&](auto&& pair) { return pair.name == name; });
             if (itr != getFns.end())
             {
-                return jsi::Value(runtime, bind_host_function(runtime, id, itr->arg_count, itr->function));
+                // NOTE: The functions resolve the target object from 'this' when called, so they can be shared by all
+                // instances of the same type
+                auto& cache = current_runtime_context()->function_cache;
+                auto cacheItr = cache.find(&*itr);
+                if (cacheItr == cache.end())
+                {
+                    auto fn = bind_host_function(runtime, id, itr->arg_count, itr->function);
+                    cacheItr = cache.emplace(&*itr, jsi::Value(runtime, std::move(fn))).first;
+                }
+
+                return jsi::Value(runtime, cacheItr->second);
             }
             else if (name == "operation"sv)
             {
@@ -1845,18 +2663,6 @@ namespace rnwinrt
             return jsi::Value::undefined();
         }
 
-        struct continuation
-        {
-            enum
-            {
-                then_type, // Covers both .then and .catch
-                finally_type,
-                done_type,
-            } kind;
-            std::optional<promise_wrapper> promise;
-            jsi::Value data[3]; // Contents depend on 'kind'
-        };
-
         enum class state
         {
             pending,
@@ -1864,6 +2670,49 @@ namespace rnwinrt
             rejected,
         };
 
+        // Many operations have already completed by the time they are returned (e.g. because the result was cached), in
+        // which case we can get the result immediately instead of waiting for the completion callback to be marshalled
+        // back to the JS thread. Continuations then only need a single task on the JS thread
+        bool try_complete_synchronously()
+        {
+            auto status = m_instance.Status();
+            if (status == winrt::Windows::Foundation::AsyncStatus::Started)
+            {
+                return false;
+            }
+
+            auto& runtime = current_runtime_context()->runtime;
+            try
+            {
+                // NOTE: Matches the behavior of 'co_await', which throws for canceled operations without calling
+                // 'GetResults'. For failed operations, 'GetResults' throws the operation's error
+                if (status == winrt::Windows::Foundation::AsyncStatus::Canceled)
+                {
+                    throw winrt::hresult_canceled();
+                }
+
+                if constexpr (!traits::is_async_with_result) // IAsyncAction*
+                {
+                    m_instance.GetResults();
+                    on_completed(runtime, jsi::Value::undefined(), true);
+                }
+                else // IAsyncOperation*
+                {
+                    on_completed(runtime, convert_native_to_value(runtime, m_instance.GetResults()), true);
+                }
+            }
+            catch (winrt::hresult_error& err)
+            {
+                on_completed(runtime, make_error(runtime, err), false);
+            }
+            catch (std::exception& err)
+            {
+                on_completed(runtime, make_error(runtime, err), false);
+            }
+
+            return true;
+        }
+
         winrt::fire_and_forget initialize()
         {
             auto strongThis = this->shared_from_this();
@@ -1900,6 +2749,34 @@ namespace rnwinrt
             }
         }
 
+        // The single Promise that represents the operation. It only gets created once JS first calls 'then', 'catch',
+        // 'finally', or 'done', which then delegate to the engine's Promise implementation
+        jsi::Object get_promise(jsi::Runtime& runtime)
+        {
+            if (!m_promise)
+            {
+                m_promise = promise_wrapper::create(runtime);
+                if (m_state != state::pending)
+                {
+                    settle_promise(runtime);
+                }
+            }
+
+            return m_promise->get().getObject(runtime);
+        }
+
+        void settle_promise(jsi::Runtime& runtime)
+        {
+            if (m_state == state::resolved)
+            {
+                m_promise->resolve(runtime, m_result);
+            }
+            else
+            {
+                m_promise->reject(runtime, m_result);
+            }
+        }
+
         jsi::Value on_cancel(jsi::Runtime&, const jsi::Value*, size_t)
         {
             m_instance.Cancel();
@@ -1909,215 +2786,106 @@ namespace rnwinrt
         jsi::Value on_catch(jsi::Runtime& runtime, const jsi::Value* args, size_t count)
         {
             // Prototype: catch(rejectCallback) -> Promise
-            // NOTE: Equivalent to 'then(null, rejectCallback)'
-            auto undefined = jsi::Value::undefined();
-            return handle_then(runtime, undefined, count >= 1 ? args[0] : undefined);
+            // NOTE: Equivalent to 'then(undefined, rejectCallback)'
+            const jsi::Value undefinedValue;
+            auto promise = get_promise(runtime);
+            return current_runtime_context()->builtins.promise_then(runtime).callWithThis(
+                runtime, promise, undefinedValue, (count >= 1) ? args[0] : undefinedValue);
         }
 
-        using handle_continuation_t = void (projected_async_instance::*)(jsi::Runtime&, continuation&&);
-
-        __declspec(noinline) jsi::Value on_done_impl(
-            jsi::Runtime& runtime, const jsi::Value* args, size_t count, handle_continuation_t handleContinuation)
+        jsi::Value on_done(jsi::Runtime& runtime, const jsi::Value* args, size_t count)
         {
             // Prototype: done(resolveCallback, rejectCallback, progressCallback)
-            continuation c{ continuation::done_type, {},
-                { count >= 1 ? jsi::Value(runtime, args[0]) : jsi::Value::undefined(),
-                    count >= 2 ? jsi::Value(runtime, args[1]) : jsi::Value::undefined(),
-                    count >= 3 ? jsi::Value(runtime, args[2]) : jsi::Value::undefined() } };
-            (this->*handleContinuation)(runtime, std::move(c));
+            // NOTE: The resolve and reject callbacks are reactions of the operation's Promise, the same as the callbacks
+            // passed to 'then', 'catch', and 'finally', so all of them run in the order that they were registered.
+            // Unlike those, 'done' does not swallow errors; anything that the callbacks don't handle gets rethrown
+            if ((count >= 3) && args[2].isObject() && (m_state == state::pending))
+            {
+                m_progressHandlers.emplace_back(runtime, args[2]);
+            }
 
-            return jsi::Value::undefined();
-        }
+            const jsi::Value undefinedValue;
+            auto& builtins = current_runtime_context()->builtins;
+            auto promise = get_promise(runtime);
+            auto continuation = builtins.promise_then(runtime)
+                                    .callWithThis(runtime, promise, (count >= 1) ? args[0] : undefinedValue,
+                                        (count >= 2) ? args[1] : undefinedValue)
+                                    .asObject(runtime);
+            builtins.promise_then(runtime).callWithThis(
+                runtime, continuation, undefinedValue, rethrow_function(runtime));
 
-        jsi::Value on_done(jsi::Runtime& runtime, const jsi::Value* args, size_t count)
-        {
-            return on_done_impl(runtime, args, count, &projected_async_instance::handle_continuation);
+            return jsi::Value::undefined();
         }
 
-        __declspec(noinline) jsi::Value on_finally_impl(
-            jsi::Runtime& runtime, const jsi::Value* args, size_t count, handle_continuation_t handleContinuation)
+        static jsi::Function rethrow_function(jsi::Runtime& runtime)
         {
-            // Prototype: finally(callback) -> Promise
-            continuation c{ continuation::finally_type, promise_wrapper::create(runtime),
-                { count >= 1 ? jsi::Value(runtime, args[0]) : jsi::Value::undefined() } };
-
-            auto result = jsi::Value(runtime, c.promise->get());
-            (this->*handleContinuation)(runtime, std::move(c));
-
-            return result;
+            return jsi::Function::createFromHostFunction(runtime, make_propid(runtime, "rethrow"), 1,
+                [](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args, size_t count) {
+                    // NOTE: Throwing here would only reject yet another Promise, so the error is thrown from a task of
+                    // its own, which reports it like any other uncaught error
+                    current_runtime_context()->call_async(
+                        [&runtime, error = (count >= 1) ? jsi::Value(runtime, args[0]) : jsi::Value::undefined()]() {
+                            throw jsi::JSError(runtime, jsi::Value(runtime, error));
+                        });
+                    return jsi::Value::undefined();
+                });
         }
 
         jsi::Value on_finally(jsi::Runtime& runtime, const jsi::Value* args, size_t count)
         {
-            return on_finally_impl(runtime, args, count, &projected_async_instance::handle_continuation);
+            // Prototype: finally(callback) -> Promise
+            const jsi::Value undefinedValue;
+            auto promise = get_promise(runtime);
+            return current_runtime_context()->builtins.promise_finally(runtime).callWithThis(
+                runtime, promise, (count >= 1) ? args[0] : undefinedValue);
         }
 
         jsi::Value on_then(jsi::Runtime& runtime, const jsi::Value* args, size_t count)
         {
-            // Prototype: then(resolvedCallback, rejectedCallback)
-            auto undefined = jsi::Value::undefined();
-            return handle_then(runtime, count >= 1 ? args[0] : undefined, count >= 2 ? args[1] : undefined);
-        }
-
-        __declspec(noinline) jsi::Value handle_then_impl(jsi::Runtime& runtime, const jsi::Value& resolvedHandler,
-            const jsi::Value& rejectedHandler, handle_continuation_t handleContinuation)
-        {
-            continuation c{ continuation::then_type, promise_wrapper::create(runtime),
-                { jsi::Value(runtime, resolvedHandler), jsi::Value(runtime, rejectedHandler) } };
-
-            auto result = jsi::Value(runtime, c.promise->get());
-            (this->*handleContinuation)(runtime, std::move(c));
-
-            return result;
-        }
-
-        jsi::Value handle_then(
-            jsi::Runtime& runtime, const jsi::Value& resolvedHandler, const jsi::Value& rejectedHandler)
-        {
-            return handle_then_impl(
-                runtime, resolvedHandler, rejectedHandler, &projected_async_instance::handle_continuation);
-        }
-
-        __declspec(noinline) void handle_continuation_impl(jsi::Runtime& runtime, continuation&& c,
-            std::function<void()> (*makeCallback)(projected_async_instance*, jsi::Runtime&, continuation&&))
-        {
-            if (m_state != state::pending)
-            {
-                // NOTE: Still expected to be async
-                // NOTE: The callback will occur on the same thread, implying that the 'Runtime' instance will still be
-                // alive and valid, hence the ref is safe
-                current_runtime_context()->call_async(makeCallback(this, runtime, std::move(c)));
-            }
-            else
-            {
-                m_continuations.push_back(std::move(c));
-            }
-        }
-
-        void handle_continuation(jsi::Runtime& runtime, continuation&& c)
-        {
-            handle_continuation_impl(runtime, std::move(c),
-                [](projected_async_instance* pThis, jsi::Runtime& runtime, continuation&& c) -> std::function<void()> {
-                    return move_only_lambda(
-                        [&runtime, strongThis = pThis->shared_from_this(), cont = std::move(c)]() mutable {
-                            strongThis->dispatch_continuation(runtime, cont);
-                        });
-                });
+            // Prototype: then(resolvedCallback, rejectedCallback) -> Promise
+            const jsi::Value undefinedValue;
+            auto promise = get_promise(runtime);
+            return current_runtime_context()->builtins.promise_then(runtime).callWithThis(runtime, promise,
+                (count >= 1) ? args[0] : undefinedValue, (count >= 2) ? args[1] : undefinedValue);
         }
 
         void on_progress(jsi::Runtime& runtime, const jsi::Value& progress)
         {
-            for (auto&& cont : m_continuations)
+            for (auto&& handler : m_progressHandlers)
             {
-                if (cont.kind != continuation::done_type)
-                    continue;
-
-                if (!cont.data[2].isObject())
-                    continue;
-
-                cont.data[2].getObject(runtime).asFunction(runtime).call(runtime, progress);
+                handler.getObject(runtime).asFunction(runtime).call(runtime, progress);
             }
         }
 
         void on_completed(jsi::Runtime& runtime, jsi::Value&& value, bool resolved)
         {
             assert(m_state == state::pending);
-            m_state = resolved ? state::resolved : state::rejected;
-            m_result = std::move(value);
 
-            for (auto& cont : m_continuations)
+            // NOTE: The operation reports its final progress before it completes, however that report may still be
+            // waiting on the throttle. Deliver it now so that it isn't lost, or delivered after completion
+            if (m_progressCallback)
             {
-                dispatch_continuation(runtime, cont);
+                m_progressCallback->close();
             }
-        }
-
-        void dispatch_continuation(jsi::Runtime& runtime, continuation& cont)
-        {
-            assert(m_state != state::pending);
-            std::optional<jsi::Value> continuationResult;
-            bool resolved = m_state == state::resolved;
 
-            switch (cont.kind)
-            {
-            case continuation::then_type:
-            case continuation::done_type: // Effectively 'then', but with progress and no promise
-                if (resolved)
-                {
-                    if (cont.data[0].isObject())
-                    {
-                        try
-                        {
-                            continuationResult =
-                                cont.data[0].getObject(runtime).asFunction(runtime).call(runtime, m_result);
-                        }
-                        catch (const jsi::JSError& err)
-                        {
-                            resolved = false;
-                            continuationResult = jsi::Value(runtime, err.value());
-                        }
-                    }
-                }
-                // NOTE: If the resolve handler of a 'Promise.then' throws, it is *not* passed on to the reject handler
-                // that was passed in the same '.then' call. We mimic that behavior here, hence the 'else' instead of
-                // re-inspecting the value of 'resolved'
-                else // rejected
-                {
-                    if (cont.data[1].isObject())
-                    {
-                        try
-                        {
-                            continuationResult =
-                                cont.data[1].getObject(runtime).asFunction(runtime).call(runtime, m_result);
-                            resolved = true;
-                        }
-                        catch (const jsi::JSError& err)
-                        {
-                            // NOTE: 'resolved' already false...
-                            continuationResult = jsi::Value(runtime, err.value());
-                        }
-                    }
-                }
-                break;
+            m_state = resolved ? state::resolved : state::rejected;
+            m_result = std::move(value);
 
-            case continuation::finally_type:
-                // NOTE: Finally does not change the value, nor the resolved state, unless there's an exception
-                if (cont.data[0].isObject())
-                {
-                    try
-                    {
-                        cont.data[0].getObject(runtime).asFunction(runtime).call(runtime, m_result);
-                    }
-                    catch (const jsi::JSError& err)
-                    {
-                        resolved = false;
-                        continuationResult = jsi::Value(runtime, err.value());
-                    }
-                }
-                break;
-            }
+            // NOTE: Progress handlers are only ever invoked while the operation is pending, so there's no need to hold
+            // onto them afterwards
+            m_progressHandlers.clear();
 
-            auto& effectiveResult = continuationResult ? *continuationResult : m_result;
-            if (cont.promise)
-            {
-                if (resolved)
-                {
-                    cont.promise->resolve(runtime, effectiveResult);
-                }
-                else
-                {
-                    cont.promise->reject(runtime, effectiveResult);
-                }
-            }
-            else if (!resolved)
+            if (m_promise)
             {
-                // Failure in 'done' scenario - throw unhandled errors instead of swallowing
-                throw jsi::JSError(runtime, jsi::Value(runtime, effectiveResult));
+                settle_promise(runtime);
             }
         }
 
         IFace m_instance;
-        sso_vector<continuation, 1> m_continuations;
+        sso_vector<jsi::Value, 1> m_progressHandlers; // The progress callbacks passed to 'done'
+        std::shared_ptr<coalesced_callback> m_progressCallback; // Only set for IAsync*WithProgress
         state m_state = state::pending;
+        std::optional<promise_wrapper> m_promise;
         jsi::Value m_result;
     };
 }
@@ -2242,7 +3010,7 @@ namespace rnwinrt
         {
             // NOTE: JSI doesn't currently seem to allow modification of arrays from native
             CheckThread();
-            auto pushFn = array.getPropertyAsFunction(runtime, "push");
+            auto& pushFn = current_runtime_context()->builtins.array_push(runtime);
             pushFn.callWithThis(runtime, array, convert_native_to_value(runtime, value));
         }
 
@@ -2257,7 +3025,7 @@ namespace rnwinrt
         {
             // NOTE: JSI doesn't currently seem to allow modification of arrays from native
             CheckThread();
-            auto spliceFn = array.getPropertyAsFunction(runtime, "splice");
+            auto& spliceFn = current_runtime_context()->builtins.array_splice(runtime);
             spliceFn.callWithThis(
                 runtime, array, static_cast<double>(index), 0, convert_native_to_value(runtime, value));
         }
@@ -2266,7 +3034,7 @@ namespace rnwinrt
         {
             // NOTE: JSI doesn't currently seem to allow modification of arrays from native
             CheckThread();
-            auto spliceFn = array.getPropertyAsFunction(runtime, "splice");
+            auto& spliceFn = current_runtime_context()->builtins.array_splice(runtime);
             spliceFn.callWithThis(runtime, array, static_cast<double>(index), 1);
         }
 
@@ -2274,7 +3042,7 @@ namespace rnwinrt
         {
             // NOTE: JSI doesn't currently seem to allow modification of arrays from native
             CheckThread();
-            auto popFn = array.getPropertyAsFunction(runtime, "pop");
+            auto& popFn = current_runtime_context()->builtins.array_pop(runtime);
             popFn.callWithThis(runtime, array);
         }
 
@@ -2351,13 +3119,262 @@ namespace rnwinrt
             return winrt::make<array_vector_view<T>>(this->runtime, this->array.getArray(this->runtime));
         }
     };
-}
 
-// Value converters
-namespace rnwinrt
-{
-    template <>
-    struct projected_value_traits<bool>
+    // JS objects and Maps with up to this many entries that are passed as an IMapView are copied into a native map
+    // rather than being wrapped. See 'convert_value_to_object_instance'
+    constexpr uint32_t max_map_view_snapshot_size = 256;
+
+    inline bool is_js_map(jsi::Runtime& runtime, const jsi::Object& object)
+    {
+        return object.instanceOf(runtime, current_runtime_context()->builtins.map(runtime));
+    }
+
+    // The keys of the entries of a JS object that is used as a map. NOTE: Unlike 'getPropertyNames', this excludes
+    // inherited enumerable properties, which is consistent with the 'hasOwnProperty' checks used for lookups
+    inline jsi::Array get_own_keys(jsi::Runtime& runtime, const jsi::Object& object)
+    {
+        auto& objectKeys = current_runtime_context()->builtins.object_keys(runtime);
+        return objectKeys.call(runtime, object).asObject(runtime).asArray(runtime);
+    }
+
+    // Copies the entries of a JS object or Map into a new native map in a single pass. Returns null if there are more
+    // than 'maxSize' entries
+    template <typename V>
+    winrt::Windows::Foundation::Collections::IMap<winrt::hstring, V> copy_to_native_map(
+        jsi::Runtime& runtime, const jsi::Object& object, uint32_t maxSize = std::numeric_limits<uint32_t>::max())
+    {
+        std::unordered_map<winrt::hstring, V> entries;
+        if (is_js_map(runtime, object))
+        {
+            if (object.getProperty(runtime, "size").asNumber() > maxSize)
+            {
+                return nullptr;
+            }
+
+            // NOTE: 'Array.from' gives us all entries as '[key, value]' arrays with a single call into JS
+            auto& arrayFrom = current_runtime_context()->builtins.array_from(runtime);
+            auto array = arrayFrom.call(runtime, object).asObject(runtime).asArray(runtime);
+            auto size = array.size(runtime);
+            entries.reserve(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                auto entry = array.getValueAtIndex(runtime, i).asObject(runtime).asArray(runtime);
+                auto key = convert_value_to_native<winrt::hstring>(runtime, entry.getValueAtIndex(runtime, 0));
+                entries.insert_or_assign(
+                    std::move(key), convert_value_to_native<V>(runtime, entry.getValueAtIndex(runtime, 1)));
+            }
+        }
+        else
+        {
+            auto names = get_own_keys(runtime, object);
+            auto size = names.size(runtime);
+            if (size > maxSize)
+            {
+                return nullptr;
+            }
+
+            entries.reserve(size);
+            for (size_t i = 0; i < size; ++i)
+            {
+                auto name = names.getValueAtIndex(runtime, i);
+                auto value = object.getProperty(runtime, name.getString(runtime));
+                entries.insert_or_assign(convert_value_to_native<winrt::hstring>(runtime, name),
+                    convert_value_to_native<V>(runtime, value));
+            }
+        }
+
+        return winrt::single_threaded_map<winrt::hstring, V>(std::move(entries));
+    }
+
+    // Implementations for passing JS objects and Maps as string-keyed maps. Like 'array_vector_base', every call reads
+    // or writes the JS object, so changes made on either side are visible to the other and calls must be made on the
+    // JS thread. Entries of objects are their enumerable properties
+    template <typename V>
+    struct object_map_base
+    {
+        object_map_base(jsi::Runtime& runtime, jsi::Object object) :
+            runtime(runtime), object(std::move(object)), is_map(is_js_map(runtime, this->object))
+        {
+        }
+
+        void CheckThread()
+        {
+            if (thread_id != std::this_thread::get_id())
+            {
+                throw winrt::hresult_wrong_thread{};
+            }
+        }
+
+        // IIterable functions
+        winrt::Windows::Foundation::Collections::IIterator<
+            winrt::Windows::Foundation::Collections::IKeyValuePair<winrt::hstring, V>>
+        First()
+        {
+            // NOTE: Iteration is over a copy of the entries, much like 'for...in' is over the properties that the
+            // object had when the loop started
+            CheckThread();
+            return copy_to_native_map<V>(runtime, object).First();
+        }
+
+        // IMapView functions, with the exception of 'Split'
+        V Lookup(const winrt::hstring& key)
+        {
+            CheckThread();
+            auto name = convert_native_to_value(runtime, key);
+            if (!has_key(name))
+            {
+                throw winrt::hresult_out_of_bounds();
+            }
+
+            if (is_map)
+            {
+                return convert_value_to_native<V>(
+                    runtime, object.getPropertyAsFunction(runtime, "get").callWithThis(runtime, object, name));
+            }
+
+            return convert_value_to_native<V>(runtime, object.getProperty(runtime, name.getString(runtime)));
+        }
+
+        std::uint32_t Size()
+        {
+            CheckThread();
+            if (is_map)
+            {
+                return static_cast<std::uint32_t>(object.getProperty(runtime, "size").asNumber());
+            }
+
+            return static_cast<std::uint32_t>(get_own_keys(runtime, object).size(runtime));
+        }
+
+        bool HasKey(const winrt::hstring& key)
+        {
+            CheckThread();
+            return has_key(convert_native_to_value(runtime, key));
+        }
+
+        // IMap functions, with the exception of 'GetView'
+        bool Insert(const winrt::hstring& key, const V& value)
+        {
+            CheckThread();
+            auto name = convert_native_to_value(runtime, key);
+            auto replaced = has_key(name);
+            if (is_map)
+            {
+                object.getPropertyAsFunction(runtime, "set")
+                    .callWithThis(runtime, object, name, convert_native_to_value(runtime, value));
+            }
+            else
+            {
+                object.setProperty(runtime, name.getString(runtime), convert_native_to_value(runtime, value));
+            }
+
+            return replaced;
+        }
+
+        void Remove(const winrt::hstring& key)
+        {
+            CheckThread();
+            auto name = convert_native_to_value(runtime, key);
+            if (!has_key(name))
+            {
+                throw winrt::hresult_out_of_bounds();
+            }
+
+            if (is_map)
+            {
+                object.getPropertyAsFunction(runtime, "delete").callWithThis(runtime, object, name);
+            }
+            else
+            {
+                current_runtime_context()->builtins.reflect_delete_property(runtime).call(runtime, object, name);
+            }
+        }
+
+        void Clear()
+        {
+            CheckThread();
+            if (is_map)
+            {
+                object.getPropertyAsFunction(runtime, "clear").callWithThis(runtime, object);
+                return;
+            }
+
+            auto& deleteFn = current_runtime_context()->builtins.reflect_delete_property(runtime);
+            auto names = get_own_keys(runtime, object);
+            for (size_t i = 0, size = names.size(runtime); i < size; ++i)
+            {
+                deleteFn.call(runtime, object, names.getValueAtIndex(runtime, i));
+            }
+        }
+
+        jsi::Runtime& runtime;
+        jsi::Object object;
+        bool is_map;
+        std::thread::id thread_id = std::this_thread::get_id();
+
+    private:
+        bool has_key(const jsi::Value& name)
+        {
+            if (is_map)
+            {
+                return object.getPropertyAsFunction(runtime, "has").callWithThis(runtime, object, name).getBool();
+            }
+
+            // NOTE: 'hasProperty' would also find inherited properties such as 'toString'
+            auto& hasOwnFn = current_runtime_context()->builtins.object_has_own_property(runtime);
+            return hasOwnFn.callWithThis(runtime, object, name).getBool();
+        }
+    };
+
+    template <typename V>
+    struct object_map_view :
+        winrt::implements<object_map_view<V>, winrt::Windows::Foundation::Collections::IMapView<winrt::hstring, V>,
+            winrt::Windows::Foundation::Collections::IIterable<
+                winrt::Windows::Foundation::Collections::IKeyValuePair<winrt::hstring, V>>>,
+        object_map_base<V>
+    {
+        using object_map_base<V>::object_map_base;
+
+        winrt::hstring GetRuntimeClassName() const
+        {
+            return L"JsObjectMapView";
+        }
+
+        void Split(winrt::Windows::Foundation::Collections::IMapView<winrt::hstring, V>& first,
+            winrt::Windows::Foundation::Collections::IMapView<winrt::hstring, V>& second)
+        {
+            first = nullptr;
+            second = nullptr;
+        }
+    };
+
+    template <typename V>
+    struct object_map :
+        winrt::implements<object_map<V>, winrt::Windows::Foundation::Collections::IMap<winrt::hstring, V>,
+            winrt::Windows::Foundation::Collections::IIterable<
+                winrt::Windows::Foundation::Collections::IKeyValuePair<winrt::hstring, V>>>,
+        object_map_base<V>
+    {
+        using object_map_base<V>::object_map_base;
+
+        winrt::hstring GetRuntimeClassName() const
+        {
+            return L"JsObjectMap";
+        }
+
+        winrt::Windows::Foundation::Collections::IMapView<winrt::hstring, V> GetView()
+        {
+            return winrt::make<object_map_view<V>>(
+                this->runtime, jsi::Value(this->runtime, this->object).getObject(this->runtime));
+        }
+    };
+}
+
+// Value converters
+namespace rnwinrt
+{
+    template <>
+    struct projected_value_traits<bool>
     {
         static jsi::Value as_value(jsi::Runtime&, bool value) noexcept
         {
@@ -2518,6 +3535,81 @@ namespace rnwinrt
         static winrt::Windows::Foundation::Numerics::float4 as_native(jsi::Runtime& runtime, const jsi::Value& value);
     };
 
+    // NOTE: ArrayBuffers and their views (typed arrays, DataView) are accepted wherever an 'IBuffer' is expected and
+    // are wrapped without copying. In the other direction, 'IBuffer' values are only projected as ArrayBuffers when
+    // 'runtime_context::buffers_as_array_buffers' is set since the projected object exposes properties (e.g.
+    // 'capacity') that an ArrayBuffer does not
+    template <>
+    struct projected_value_traits<winrt::Windows::Storage::Streams::IBuffer>
+    {
+        static jsi::Value as_value(jsi::Runtime& runtime, const winrt::Windows::Storage::Streams::IBuffer& value);
+        static winrt::Windows::Storage::Streams::IBuffer as_native(jsi::Runtime& runtime, const jsi::Value& value);
+    };
+
+    // Creates an ArrayBuffer that holds a copy of 'byteLength' bytes from 'data'
+    jsi::ArrayBuffer make_array_buffer(jsi::Runtime& runtime, const void* data, std::size_t byteLength);
+
+    // Creates an async iterator (i.e. an object usable in a 'for await' loop) that produces the contents of 'stream'
+    // as a sequence of ArrayBuffers of at most 'chunkSize' bytes, reading up to 'readAhead' chunks ahead of the
+    // consumer
+    jsi::Value create_stream_reader(jsi::Runtime& runtime, winrt::Windows::Storage::Streams::IInputStream stream,
+        std::uint32_t chunkSize, std::uint32_t readAhead);
+
+    // Creates a typed array that holds a copy of 'byteLength' bytes from 'data'
+    jsi::Value make_typed_array(jsi::Runtime& runtime, typed_array_type type, const void* data, std::size_t byteLength);
+
+#if RNWINRT_JSI_HAS_MUTABLE_BUFFER
+    // Creates a typed array that views the memory of 'buffer' without copying it
+    jsi::Value make_typed_array(
+        jsi::Runtime& runtime, typed_array_type type, std::shared_ptr<jsi::MutableBuffer> buffer);
+
+    // Transfers ownership of a 'com_array' to an ArrayBuffer
+    template <typename T>
+    struct com_array_buffer final : public jsi::MutableBuffer
+    {
+        com_array_buffer(winrt::com_array<T>&& array) : m_array(std::move(array))
+        {
+        }
+
+        virtual size_t size() const override
+        {
+            return m_array.size() * sizeof(T);
+        }
+
+        virtual uint8_t* data() override
+        {
+            return reinterpret_cast<uint8_t*>(m_array.data());
+        }
+
+    private:
+        winrt::com_array<T> m_array;
+    };
+#endif
+
+    // If 'object' is an ArrayBuffer, or a typed array whose type is 'type', returns the memory that holds its contents.
+    // Note that the memory is only valid for as long as the object is alive and its buffer is not detached
+    std::optional<span<std::uint8_t>> try_get_typed_array_data(
+        jsi::Runtime& runtime, const jsi::Object& object, typed_array_type type, std::size_t elementSize);
+
+    template <typename T>
+    std::optional<span<T>> try_get_typed_array_view(
+        [[maybe_unused]] jsi::Runtime& runtime, [[maybe_unused]] const jsi::Value& value)
+    {
+        if constexpr (typed_array_traits<T>::is_supported)
+        {
+            if (value.isObject())
+            {
+                auto obj = value.getObject(runtime);
+                if (auto data = try_get_typed_array_data(runtime, obj, typed_array_traits<T>::type, sizeof(T)))
+                {
+                    return span<T>(reinterpret_cast<T*>(data->data()), data->size() / sizeof(T));
+                }
+            }
+        }
+
+        return std::nullopt;
+    }
+
     template <typename T>
     struct value_fill_array_wrapper
     {
@@ -2553,10 +3645,18 @@ namespace rnwinrt
     template <typename T>
     struct native_fill_array_wrapper
     {
-        native_fill_array_wrapper(jsi::Runtime& runtime, const jsi::Value& value) :
-            m_runtime(runtime), m_jsArray(value.asObject(runtime).asArray(runtime))
+        native_fill_array_wrapper(jsi::Runtime& runtime, const jsi::Value& value) : m_runtime(runtime)
         {
-            auto size = m_jsArray.size(runtime);
+            // NOTE: The callee writes directly into the memory of ArrayBuffers and typed arrays of the same type. The
+            // caller keeps the JS object alive for the duration of the call
+            if (auto view = try_get_typed_array_view<T>(runtime, value))
+            {
+                m_directArray = winrt::array_view<T>(view->data(), static_cast<std::uint32_t>(view->size()));
+                return;
+            }
+
+            m_jsArray = value.asObject(runtime).asArray(runtime);
+            auto size = m_jsArray->size(runtime);
             if constexpr (std::is_base_of_v<winrt::Windows::Foundation::IUnknown, T>)
             {
                 m_nativeArray.resize(size, nullptr);
@@ -2569,21 +3669,32 @@ namespace rnwinrt
 
         ~native_fill_array_wrapper() noexcept(false)
         {
+            if (!m_jsArray)
+            {
+                return;
+            }
+
             for (std::size_t i = 0; i < m_nativeArray.size(); ++i)
             {
-                m_jsArray.setValueAtIndex(m_runtime, i, convert_native_to_value(m_runtime, m_nativeArray[i]));
+                m_jsArray->setValueAtIndex(m_runtime, i, convert_native_to_value(m_runtime, m_nativeArray[i]));
             }
         }
 
         operator winrt::array_view<T>()
         {
+            if (m_directArray)
+            {
+                return *m_directArray;
+            }
+
             return winrt::array_view<T>(m_nativeArray.data(), static_cast<std::uint32_t>(m_nativeArray.size()));
         }
 
     private:
         jsi::Runtime& m_runtime;
-        jsi::Array m_jsArray;
+        std::optional<jsi::Array> m_jsArray;
         sso_vector<T, 4> m_nativeArray; // NOTE: Because std::vector<bool> makes everyone sad...
+        std::optional<winrt::array_view<T>> m_directArray;
     };
 
     template <typename T>
@@ -2606,6 +3717,14 @@ namespace rnwinrt
     {
         pass_array_wrapper(jsi::Runtime& runtime, const jsi::Value& value)
         {
+            // NOTE: ArrayBuffers and typed arrays of the same type are passed to the callee without copying. The caller
+            // keeps the JS object alive for the duration of the call
+            if (auto view = try_get_typed_array_view<T>(runtime, value))
+            {
+                m_directArray = winrt::array_view<const T>(view->data(), static_cast<std::uint32_t>(view->size()));
+                return;
+            }
+
             auto array = value.asObject(runtime).asArray(runtime);
             auto size = array.size(runtime);
             m_data.reserve(size);
@@ -2617,11 +3736,17 @@ namespace rnwinrt
 
         operator winrt::array_view<const T>()
         {
+            if (m_directArray)
+            {
+                return *m_directArray;
+            }
+
             return winrt::array_view<const T>(m_data.data(), static_cast<std::uint32_t>(m_data.size()));
         }
 
     private:
         sso_vector<T, 4> m_data; // NOTE: Because std::vector<bool> makes everyone sad...
+        std::optional<winrt::array_view<const T>> m_directArray;
     };
 
     template <typename T>
@@ -2630,6 +3755,15 @@ namespace rnwinrt
         // NOTE: Const 'T' - this is specific to 'pass array' scenarios
         static jsi::Value as_value(jsi::Runtime& runtime, const winrt::array_view<const T>& value)
         {
+            if constexpr (typed_array_traits<T>::is_supported)
+            {
+                if (current_runtime_context()->typed_arrays)
+                {
+                    return make_typed_array(
+                        runtime, typed_array_traits<T>::type, value.data(), value.size() * sizeof(T));
+                }
+            }
+
             // Array is immutable; we can convert to a JS array and call it a day
             jsi::Array result(runtime, value.size());
             for (uint32_t i = 0; i < value.size(); ++i)
@@ -2651,6 +3785,15 @@ namespace rnwinrt
     {
         static jsi::Value as_value(jsi::Runtime& runtime, const winrt::com_array<T>& value)
         {
+            if constexpr (typed_array_traits<T>::is_supported)
+            {
+                if (current_runtime_context()->typed_arrays)
+                {
+                    return make_typed_array(
+                        runtime, typed_array_traits<T>::type, value.data(), value.size() * sizeof(T));
+                }
+            }
+
             auto result = jsi::Array(runtime, value.size());
             for (std::uint32_t i = 0; i < value.size(); ++i)
             {
@@ -2660,6 +3803,23 @@ namespace rnwinrt
             return result;
         }
 
+        static jsi::Value as_value(jsi::Runtime& runtime, winrt::com_array<T>&& value)
+        {
+#if RNWINRT_JSI_HAS_MUTABLE_BUFFER
+            if constexpr (typed_array_traits<T>::is_supported)
+            {
+                // NOTE: When we own the array, the typed array can use its memory directly
+                if (current_runtime_context()->typed_arrays && !value.empty())
+                {
+                    return make_typed_array(
+                        runtime, typed_array_traits<T>::type, std::make_shared<com_array_buffer<T>>(std::move(value)));
+                }
+            }
+#endif
+
+            return as_value(runtime, static_cast<const winrt::com_array<T>&>(value));
+        }
+
         static winrt::com_array<T> as_native(jsi::Runtime& runtime, const jsi::Value& value)
         {
             auto array = value.asObject(runtime).asArray(runtime);
@@ -2689,13 +3849,9 @@ namespace rnwinrt
         }
         else if constexpr (std::is_same_v<T, winrt::Windows::Foundation::IInspectable>)
         {
-            if (auto propVal = value.try_as<winrt::Windows::Foundation::IPropertyValue>())
-            {
-                if (auto result = convert_from_property_value(runtime, propVal); !result.isUndefined())
-                {
-                    return result;
-                }
-            }
+            // NOTE: Whether or not the object implements IPropertyValue is cached per runtime class, so this avoids a
+            // QueryInterface for every object
+            return current_runtime_context()->instance_cache.get_instance(runtime, value, true);
         }
 
         return current_runtime_context()->instance_cache.get_instance(runtime, value);
@@ -2713,9 +3869,9 @@ namespace rnwinrt
         if (value.isObject())
         {
             auto obj = value.getObject(runtime);
-            if (obj.isHostObject<projected_object_instance>(runtime))
+            if (auto instance = projected_object_instance::from_object(runtime, obj))
             {
-                return asTargetType(obj.getHostObject<projected_object_instance>(runtime)->instance());
+                return asTargetType(instance->instance());
             }
         }
 
@@ -2781,7 +3937,34 @@ namespace rnwinrt
             }
         }
 
-        // TODO: Also IMap/IMapView?
+        if constexpr (pinterface_traits<T>::is_map_convertible)
+        {
+            if (value.isObject())
+            {
+                auto obj = value.getObject(runtime);
+                if (!obj.isArray(runtime) && !obj.isFunction(runtime) && !obj.isHostObject(runtime))
+                {
+                    // NOTE: Small read-only maps are copied since that avoids a call into JS for every access by the
+                    // callee, which can then also use it from any thread. Everything else is wrapped to avoid copying
+                    // large objects and so that changes made through an IMap are visible to the caller
+                    using value_type = typename pinterface_traits<T>::value_type;
+                    if constexpr (pinterface_traits<T>::is_map_view)
+                    {
+                        if (auto map = copy_to_native_map<value_type>(runtime, obj, max_map_view_snapshot_size))
+                        {
+                            return map.GetView();
+                        }
+
+                        return winrt::make<object_map_view<value_type>>(runtime, std::move(obj));
+                    }
+                    else // is_map
+                    {
+                        static_assert(pinterface_traits<T>::is_map);
+                        return winrt::make<object_map<value_type>>(runtime, std::move(obj));
+                    }
+                }
+            }
+        }
 
         throw jsi::JSError(runtime, "TypeError: Cannot derive a WinRT interface for the JS value");
     }
@@ -2908,6 +4091,90 @@ namespace rnwinrt
         }
     };
 
+    // The JS function targeted by a delegate that was created while 'runtime_context::delegate_options' selected
+    // 'async' delivery. The arguments are copied into the callback that gets queued to the JS thread and are only
+    // converted to JS values once it runs. This object is shared with the queued callbacks since they may still run
+    // after the delegate has been destroyed (e.g. after the listener was removed)
+    struct async_delegate_function : std::enable_shared_from_this<async_delegate_function>
+    {
+        async_delegate_function(jsi::Runtime& runtime, const jsi::Value& value, const event_options& options);
+        ~async_delegate_function();
+
+        // Returns null if delegates currently get created with 'sync' delivery
+        static std::shared_ptr<async_delegate_function> create(jsi::Runtime& runtime, const jsi::Value& value);
+
+        template <typename... Args>
+        void invoke(const Args&... args)
+        {
+            if (m_coalescer)
+            {
+                // NOTE: Invocations that are still pending when the delegate gets destroyed are dropped
+                m_coalescer->submit([weakThis = weak_from_this(), args...]() {
+                    if (auto strongThis = weakThis.lock())
+                    {
+                        strongThis->call_function(args...);
+                    }
+                });
+            }
+            else
+            {
+                m_context->call([strongThis = shared_from_this(), args...]() { strongThis->call_function(args...); });
+            }
+        }
+
+    private:
+        template <typename... Args>
+        void call_function(const Args&... args)
+        {
+            auto& runtime = m_context->runtime;
+            m_function.call(runtime, convert_native_to_value(runtime, args)...);
+        }
+
+        shared_runtime_context m_context;
+        jsi::Function m_function;
+
+        // Only set for 'latest_only' or throttled delivery
+        std::shared_ptr<coalesced_callback> m_coalescer;
+    };
+
+    // State shared by a mirror - a JS array or object that is kept in sync with an observable collection - and the
+    // change handler that the mirror registers with the collection. The handler records each change, along with the
+    // values that it affects, on the thread that raised it and applies it to the mirror on the JS thread; reading the
+    // values any later would apply changes made in the meantime more than once. The mirror itself is only weakly
+    // referenced, so that the collection does not keep it alive; the handler unregisters itself once the mirror has
+    // been garbage collected
+    struct collection_mirror
+    {
+        collection_mirror(jsi::Runtime& runtime, const jsi::Object& mirror);
+        ~collection_mirror();
+
+        shared_runtime_context context;
+        winrt::event_token token{};
+
+        // Called by the change handler, on any thread. Returns the sequence number of the change, which gets passed to
+        // 'target' once the change is being applied
+        uint64_t record_change() noexcept
+        {
+            return ++m_changes;
+        }
+
+        // Called immediately before the initial contents of the mirror get read from the collection. Changes recorded
+        // before then are already reflected in those contents
+        void begin_snapshot() noexcept
+        {
+            m_snapshotChange = m_changes;
+        }
+
+        // Returns the mirror if the change with the sequence number 'change' still needs to be applied to it. Must be
+        // called on the JS thread. 'isAlive' is set to false if the mirror has been garbage collected
+        std::optional<jsi::Object> target(jsi::Runtime& runtime, uint64_t change, bool& isAlive);
+
+    private:
+        jsi::WeakObject m_mirror;
+        std::atomic<uint64_t> m_changes{ 0 };
+        uint64_t m_snapshotChange = 0;
+    };
+
     template <typename T>
     struct projected_value_traits<winrt::Windows::Foundation::EventHandler<T>>
     {
@@ -2929,11 +4196,16 @@ namespace rnwinrt
 
         static winrt::Windows::Foundation::EventHandler<T> as_native(jsi::Runtime& runtime, const jsi::Value& value)
         {
+            if (auto fn = async_delegate_function::create(runtime, value))
+            {
+                return [fn = std::move(fn)](const winrt::Windows::Foundation::IInspectable& sender, const T& args) {
+                    fn->invoke(sender, args);
+                };
+            }
+
             return
                 [ctxt = current_runtime_context()->add_reference(), fn = value.asObject(runtime).asFunction(runtime)](
                     const winrt::Windows::Foundation::IInspectable& sender, const T& args) {
-                    // TODO: Do we need to call synchronously? One reason might be to propagate errors, but typically
-                    // event sources don't care about those.
                     ctxt->call_sync([&]() {
                         fn.call(ctxt->runtime, convert_native_to_value(ctxt->runtime, sender),
                             convert_native_to_value(ctxt->runtime, args));
@@ -2965,6 +4237,11 @@ namespace rnwinrt
         static winrt::Windows::Foundation::TypedEventHandler<TSender, TResult> as_native(
             jsi::Runtime& runtime, const jsi::Value& value)
         {
+            if (auto fn = async_delegate_function::create(runtime, value))
+            {
+                return [fn = std::move(fn)](const TSender& sender, const TResult& args) { fn->invoke(sender, args); };
+            }
+
             return [ctxt = current_runtime_context()->add_reference(),
                        fn = value.asObject(runtime).asFunction(runtime)](const TSender& sender, const TResult& args) {
                 ctxt->call_sync([&]() {
@@ -2999,67 +4276,359 @@ namespace rnwinrt
                 });
         }
 
-        static winrt::Windows::Foundation::Collections::MapChangedEventHandler<K, V> as_native(
-            jsi::Runtime& runtime, const jsi::Value& value)
+        static winrt::Windows::Foundation::Collections::MapChangedEventHandler<K, V> as_native(
+            jsi::Runtime& runtime, const jsi::Value& value)
+        {
+            if (auto fn = async_delegate_function::create(runtime, value))
+            {
+                return [fn = std::move(fn)](const winrt::Windows::Foundation::Collections::IObservableMap<K, V>& sender,
+                           const winrt::Windows::Foundation::Collections::IMapChangedEventArgs<K>& args) {
+                    fn->invoke(sender, args);
+                };
+            }
+
+            return
+                [ctxt = current_runtime_context()->add_reference(), fn = value.asObject(runtime).asFunction(runtime)](
+                    const winrt::Windows::Foundation::Collections::IObservableMap<K, V>& sender,
+                    const winrt::Windows::Foundation::Collections::IMapChangedEventArgs<K>& args) {
+                    ctxt->call_sync([&]() {
+                        fn.call(ctxt->runtime, convert_native_to_value(ctxt->runtime, sender),
+                            convert_native_to_value(ctxt->runtime, args));
+                    });
+                };
+        }
+    };
+
+    template <typename T>
+    struct projected_value_traits<winrt::Windows::Foundation::Collections::VectorChangedEventHandler<T>>
+    {
+        static jsi::Value as_value(
+            jsi::Runtime& runtime, const winrt::Windows::Foundation::Collections::VectorChangedEventHandler<T>& value)
+        {
+            return jsi::Function::createFromHostFunction(runtime, make_propid(runtime, "VectorChangedEventHandler"), 2,
+                [value](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args, size_t count) {
+                    if (count != 2)
+                    {
+                        throw_invalid_delegate_arg_count(
+                            runtime, "Windows.Foundation.Collections"sv, "VectorChangedEventHandler");
+                    }
+
+                    auto arg0 = convert_value_to_native<winrt::Windows::Foundation::Collections::IObservableVector<T>>(
+                        runtime, args[0]);
+                    auto arg1 =
+                        convert_value_to_native<winrt::Windows::Foundation::Collections::IVectorChangedEventArgs>(
+                            runtime, args[1]);
+                    value(arg0, arg1);
+                    return jsi::Value::undefined();
+                });
+        }
+
+        static winrt::Windows::Foundation::Collections::VectorChangedEventHandler<T> as_native(
+            jsi::Runtime& runtime, const jsi::Value& value)
+        {
+            if (auto fn = async_delegate_function::create(runtime, value))
+            {
+                return [fn = std::move(fn)](const winrt::Windows::Foundation::Collections::IObservableVector<T>& sender,
+                           const winrt::Windows::Foundation::Collections::IVectorChangedEventArgs& args) {
+                    fn->invoke(sender, args);
+                };
+            }
+
+            return
+                [ctxt = current_runtime_context()->add_reference(), fn = value.asObject(runtime).asFunction(runtime)](
+                    const winrt::Windows::Foundation::Collections::IObservableVector<T>& sender,
+                    const winrt::Windows::Foundation::Collections::IVectorChangedEventArgs& args) {
+                    ctxt->call_sync([&]() {
+                        fn.call(ctxt->runtime, convert_native_to_value(ctxt->runtime, sender),
+                            convert_native_to_value(ctxt->runtime, args));
+                    });
+                };
+        }
+    };
+}
+
+// Static data for generic types
+namespace rnwinrt
+{
+    namespace interfaces::Windows::Foundation::Collections
+    {
+        using winrt::Windows::Foundation::IInspectable;
+
+        // Returns the value that elements of arrays that get filled in by 'GetMany' are initialized to. Default
+        // constructing a runtime class would activate a new instance of it (or fail to compile), so these use null
+        template <typename T>
+        T empty_collection_value()
+        {
+            if constexpr (std::is_base_of_v<winrt::Windows::Foundation::IUnknown, T>)
+            {
+                return nullptr;
+            }
+            else
+            {
+                return T{};
+            }
+        }
+
+        // A reusable buffer that elements of a collection are read into using 'GetMany'. The buffer holds up to
+        // 'runtime_context::collection_chunk_size' elements, so reading a collection makes one ABI call per chunk as
+        // opposed to one per element
+        template <typename T>
+        struct collection_chunk_buffer
+        {
+            collection_chunk_buffer(uint32_t maxSize) :
+                m_capacity(std::min(maxSize, current_runtime_context()->collection_chunk_size)),
+                m_data(m_capacity, empty_collection_value<T>())
+            {
+            }
+
+            uint32_t capacity() const noexcept
+            {
+                return m_capacity;
+            }
+
+            T& operator[](uint32_t index) noexcept
+            {
+                assert(index < m_size);
+                return m_data[index];
+            }
+
+            // Reads up to 'maxCount' elements starting at 'startIndex' of an IVector or IVectorView, replacing the
+            // previous contents of the buffer. Returns the number of elements read
+            template <typename TVector>
+            uint32_t read(const TVector& vector, uint32_t startIndex, uint32_t maxCount)
+            {
+                reset();
+                auto count = std::min(maxCount, m_capacity);
+                m_size = vector.GetMany(startIndex, winrt::array_view<T>(m_data.data(), m_data.data() + count));
+                return m_size;
+            }
+
+            // Reads up to 'capacity()' elements from the current position of an IIterator, advancing it past the
+            // elements that were read. Returns the number of elements read, which is zero once the end of the
+            // collection is reached
+            uint32_t read(const winrt::Windows::Foundation::Collections::IIterator<T>& iterator)
+            {
+                reset();
+                m_size = iterator.GetMany(m_data);
+                return m_size;
+            }
+
+        private:
+            void reset() noexcept
+            {
+                // NOTE: 'GetMany' fills the buffer without releasing its previous contents, so we need to do that here
+                if constexpr (!std::is_trivially_destructible_v<T>)
+                {
+                    std::fill_n(m_data.data(), m_size, empty_collection_value<T>());
+                }
+
+                m_size = 0;
+            }
+
+            uint32_t m_capacity;
+            uint32_t m_size = 0;
+            winrt::com_array<T> m_data;
+        };
+
+        // Calls 'fn(value, index)' for each element in the range ['begin', 'end') of an IVector or IVectorView, in
+        // order, stopping early if 'fn' returns false. Returns false if 'fn' stopped the iteration. Elements are read
+        // in chunks, so changes that 'fn' makes to the vector may not be observed until the next chunk is read. The
+        // iteration also stops early if the vector shrinks
+        template <typename TVector, typename Func>
+        bool vector_for_each(const TVector& vector, uint32_t begin, uint32_t end, Func&& fn)
+        {
+            collection_chunk_buffer<typename pinterface_traits<TVector>::value_type> buffer(
+                (begin < end) ? (end - begin) : 0);
+            while (begin < end)
+            {
+                auto count = buffer.read(vector, begin, end - begin);
+                if (count == 0)
+                {
+                    break;
+                }
+
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    if (!fn(buffer[i], begin + i))
+                    {
+                        return false;
+                    }
+                }
+
+                begin += count;
+            }
+
+            return true;
+        }
+
+        // Same as 'vector_for_each', except that elements are visited in reverse order (i.e. starting at 'end - 1')
+        template <typename TVector, typename Func>
+        bool vector_for_each_reverse(const TVector& vector, uint32_t begin, uint32_t end, Func&& fn)
+        {
+            collection_chunk_buffer<typename pinterface_traits<TVector>::value_type> buffer(
+                (begin < end) ? (end - begin) : 0);
+            while (begin < end)
+            {
+                auto chunkBegin = ((end - begin) > buffer.capacity()) ? (end - buffer.capacity()) : begin;
+                auto count = buffer.read(vector, chunkBegin, end - chunkBegin);
+                for (auto i = count; i-- > 0;)
+                {
+                    if (!fn(buffer[i], chunkBegin + i))
+                    {
+                        return false;
+                    }
+                }
+
+                end = chunkBegin;
+            }
+
+            return true;
+        }
+
+        // Calls 'fn(value)' for each element of an IIterable, in order. Elements are read in chunks using the
+        // iterator's 'GetMany' function. 'sizeHint' is the number of elements that the collection is expected to have,
+        // if known
+        template <typename T, typename Func>
+        void iterable_for_each(const winrt::Windows::Foundation::Collections::IIterable<T>& iterable, Func&& fn,
+            uint32_t sizeHint = std::numeric_limits<uint32_t>::max())
+        {
+            collection_chunk_buffer<T> buffer(sizeHint);
+            auto iterator = iterable.First();
+            while (auto count = buffer.read(iterator))
+            {
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    fn(buffer[i]);
+                }
+            }
+        }
+
+        template <typename T>
+        struct key_value_pair_traits
+        {
+            static constexpr bool is_key_value_pair = false;
+        };
+
+        template <typename K, typename V>
+        struct key_value_pair_traits<winrt::Windows::Foundation::Collections::IKeyValuePair<K, V>>
+        {
+            static constexpr bool is_key_value_pair = true;
+            using key_type = K;
+            using value_type = V;
+        };
+
+        // Returns the number of elements in an IIterable if it is also a vector or map, which is cheaper than counting
+        // them as they are read
+        template <typename T>
+        std::optional<uint32_t> iterable_size(const winrt::Windows::Foundation::Collections::IIterable<T>& iterable)
+        {
+            using namespace winrt::Windows::Foundation::Collections;
+            if constexpr (key_value_pair_traits<T>::is_key_value_pair)
+            {
+                using K = typename key_value_pair_traits<T>::key_type;
+                using V = typename key_value_pair_traits<T>::value_type;
+                if (auto map = iterable.template try_as<IMapView<K, V>>())
+                    return map.Size();
+                else if (auto map = iterable.template try_as<IMap<K, V>>())
+                    return map.Size();
+            }
+            else
+            {
+                if (auto vector = iterable.template try_as<IVectorView<T>>())
+                    return vector.Size();
+                else if (auto vector = iterable.template try_as<IVector<T>>())
+                    return vector.Size();
+            }
+
+            return std::nullopt;
+        }
+
+        // Elements of maps are projected as '[key, value]' arrays, the same as the entries of a JS Map
+        template <typename T>
+        jsi::Value collection_element_to_value(jsi::Runtime& runtime, const T& value)
+        {
+            if constexpr (key_value_pair_traits<T>::is_key_value_pair)
+            {
+                jsi::Array result(runtime, 2);
+                result.setValueAtIndex(runtime, 0, convert_native_to_value(runtime, value.Key()));
+                result.setValueAtIndex(runtime, 1, convert_native_to_value(runtime, value.Value()));
+                return result;
+            }
+            else
+            {
+                return convert_native_to_value(runtime, value);
+            }
+        }
+
+        // Copies all elements of an IIterable into a new JS array in a single pass. Vectors are read by index, all
+        // other collections are read through their iterator. Either way, elements are read in chunks using 'GetMany'
+        template <typename T>
+        inline __declspec(noinline) jsi::Value iterable_to_array_impl(
+            jsi::Runtime& runtime, const winrt::Windows::Foundation::Collections::IIterable<T>& iterable)
         {
-            return
-                [ctxt = current_runtime_context()->add_reference(), fn = value.asObject(runtime).asFunction(runtime)](
-                    const winrt::Windows::Foundation::Collections::IObservableMap<K, V>& sender,
-                    const winrt::Windows::Foundation::Collections::IMapChangedEventArgs<K>& args) {
-                    ctxt->call_sync([&]() {
-                        fn.call(ctxt->runtime, convert_native_to_value(ctxt->runtime, sender),
-                            convert_native_to_value(ctxt->runtime, args));
+            auto size = iterable_size(iterable);
+            if constexpr (!key_value_pair_traits<T>::is_key_value_pair)
+            {
+                auto fromVector = [&](const auto& vector) {
+                    jsi::Array result(runtime, *size);
+                    vector_for_each(vector, 0, *size, [&](auto& value, uint32_t index) {
+                        result.setValueAtIndex(runtime, index, convert_native_to_value(runtime, value));
+                        return true;
                     });
+                    return result;
                 };
-        }
-    };
 
-    template <typename T>
-    struct projected_value_traits<winrt::Windows::Foundation::Collections::VectorChangedEventHandler<T>>
-    {
-        static jsi::Value as_value(
-            jsi::Runtime& runtime, const winrt::Windows::Foundation::Collections::VectorChangedEventHandler<T>& value)
-        {
-            return jsi::Function::createFromHostFunction(runtime, make_propid(runtime, "VectorChangedEventHandler"), 2,
-                [value](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value* args, size_t count) {
-                    if (count != 2)
-                    {
-                        throw_invalid_delegate_arg_count(
-                            runtime, "Windows.Foundation.Collections"sv, "VectorChangedEventHandler");
-                    }
+                using namespace winrt::Windows::Foundation::Collections;
+                if (auto view = iterable.template try_as<IVectorView<T>>())
+                    return fromVector(view);
+                else if (auto vector = iterable.template try_as<IVector<T>>())
+                    return fromVector(vector);
+            }
 
-                    auto arg0 = convert_value_to_native<winrt::Windows::Foundation::Collections::IObservableVector<T>>(
-                        runtime, args[0]);
-                    auto arg1 =
-                        convert_value_to_native<winrt::Windows::Foundation::Collections::IVectorChangedEventArgs>(
-                            runtime, args[1]);
-                    value(arg0, arg1);
-                    return jsi::Value::undefined();
-                });
+            // NOTE: The size is only a hint here since the iterator is the source of truth, so we can't write directly
+            // into the JS array until we know how many elements there are
+            std::vector<jsi::Value> values;
+            values.reserve(size.value_or(0));
+            iterable_for_each(
+                iterable, [&](auto& value) { values.push_back(collection_element_to_value(runtime, value)); },
+                size.value_or(std::numeric_limits<uint32_t>::max()));
+
+            jsi::Array result(runtime, values.size());
+            for (size_t i = 0; i < values.size(); ++i)
+            {
+                result.setValueAtIndex(runtime, i, std::move(values[i]));
+            }
+
+            return result;
         }
 
-        static winrt::Windows::Foundation::Collections::VectorChangedEventHandler<T> as_native(
-            jsi::Runtime& runtime, const jsi::Value& value)
+        // Copies all entries of a map into a new JS object, whose property names are the map's keys converted to
+        // strings. If multiple keys convert to the same string, the last one wins
+        template <typename K, typename V>
+        inline __declspec(noinline) jsi::Value iterable_to_object_impl(jsi::Runtime& runtime,
+            const winrt::Windows::Foundation::Collections::IIterable<
+                winrt::Windows::Foundation::Collections::IKeyValuePair<K, V>>& iterable)
         {
-            return
-                [ctxt = current_runtime_context()->add_reference(), fn = value.asObject(runtime).asFunction(runtime)](
-                    const winrt::Windows::Foundation::Collections::IObservableVector<T>& sender,
-                    const winrt::Windows::Foundation::Collections::IVectorChangedEventArgs& args) {
-                    ctxt->call_sync([&]() {
-                        fn.call(ctxt->runtime, convert_native_to_value(ctxt->runtime, sender),
-                            convert_native_to_value(ctxt->runtime, args));
-                    });
-                };
+            jsi::Object result(runtime);
+            iterable_for_each(
+                iterable,
+                [&](auto& pair) {
+                    auto key = convert_native_to_value(runtime, pair.Key()).toString(runtime);
+                    result.setProperty(runtime, key, convert_native_to_value(runtime, pair.Value()));
+                },
+                iterable_size(iterable).value_or(std::numeric_limits<uint32_t>::max()));
+            return result;
         }
-    };
-}
 
-// Static data for generic types
-namespace rnwinrt
-{
-    namespace interfaces::Windows::Foundation::Collections
-    {
-        using winrt::Windows::Foundation::IInspectable;
+        // Copies all entries of a map into a new JS Map
+        template <typename K, typename V>
+        inline __declspec(noinline) jsi::Value iterable_to_map_impl(jsi::Runtime& runtime,
+            const winrt::Windows::Foundation::Collections::IIterable<
+                winrt::Windows::Foundation::Collections::IKeyValuePair<K, V>>& iterable)
+        {
+            auto entries = iterable_to_array_impl(runtime, iterable);
+            return current_runtime_context()->builtins.map(runtime).callAsConstructor(runtime, entries);
+        }
 
         namespace IIterable
         {
@@ -3070,8 +4639,39 @@ namespace rnwinrt
 
                 static constexpr const static_interface_data::function_mapping functions[] = {
                     { "first",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value*) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().First());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value*) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).First());
+                        } },
+                    { "toArray",
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value*) {
+                            return iterable_to_array_impl(runtime, interface_cast<native_type>(thisValue));
+                        } },
+                };
+            };
+
+            // Iterables of key/value pairs (i.e. maps) can additionally be copied into JS objects and Maps
+            template <typename K, typename V>
+            struct interface_data<winrt::Windows::Foundation::Collections::IKeyValuePair<K, V>>
+            {
+                using native_type = winrt::Windows::Foundation::Collections::IIterable<
+                    winrt::Windows::Foundation::Collections::IKeyValuePair<K, V>>;
+
+                static constexpr const static_interface_data::function_mapping functions[] = {
+                    { "first",
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value*) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).First());
+                        } },
+                    { "toArray",
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value*) {
+                            return iterable_to_array_impl(runtime, interface_cast<native_type>(thisValue));
+                        } },
+                    { "toMap",
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value*) {
+                            return iterable_to_map_impl(runtime, interface_cast<native_type>(thisValue));
+                        } },
+                    { "toObject",
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value*) {
+                            return iterable_to_object_impl(runtime, interface_cast<native_type>(thisValue));
                         } },
                 };
             };
@@ -3097,27 +4697,29 @@ namespace rnwinrt
 
                 static constexpr const static_interface_data::property_mapping properties[] = {
                     { "current",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Current());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).Current());
                         },
                         nullptr },
                     { "hasCurrent",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().HasCurrent());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                            return convert_native_to_value(
+                                runtime, interface_cast<native_type>(thisValue).HasCurrent());
                         },
                         nullptr },
                 };
 
                 static constexpr const static_interface_data::function_mapping functions[] = {
                     { "getMany",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto items = convert_value_to_native<winrt::array_view<T>>(runtime, args[0]);
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().GetMany(items));
+                            return convert_native_to_value(
+                                runtime, interface_cast<native_type>(thisValue).GetMany(items));
                         },
                         1, false },
                     { "moveNext",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value*) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().MoveNext());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value*) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).MoveNext());
                         },
                         0, false },
                 };
@@ -3144,13 +4746,13 @@ namespace rnwinrt
 
                 static constexpr const static_interface_data::property_mapping properties[] = {
                     { "key",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Key());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).Key());
                         },
                         nullptr },
                     { "value",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Value());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).Value());
                         },
                         nullptr },
                 };
@@ -3168,6 +4770,49 @@ namespace rnwinrt
             constexpr const static_interface_data& data = data_t<K, V>::value;
         }
 
+        // Looks up 'key' in an IMap or IMapView, returning an empty optional if the map does not contain it. Unlike
+        // 'HasKey' followed by 'Lookup', hits only take a single call and misses are not reported by throwing
+        template <typename TMap, typename K>
+        std::optional<decltype(std::declval<TMap>().Lookup(std::declval<K>()))> map_try_lookup(
+            const TMap& map, const K& key)
+        {
+            using value_type = decltype(map.Lookup(key));
+            if constexpr (std::is_base_of_v<winrt::Windows::Foundation::IUnknown, value_type>)
+            {
+                // NOTE: For interface values, 'TryLookup' reports misses as null, which is ambiguous with entries whose
+                // value is null
+                if (auto value = map.TryLookup(key); value || map.HasKey(key))
+                {
+                    return value;
+                }
+
+                return std::nullopt;
+            }
+            else
+            {
+                return map.TryLookup(key);
+            }
+        }
+
+        // Shared implementation of 'runtime_get_property' for IMap and IMapView: maps with string keys project their
+        // entries as properties
+        template <typename K, typename TMap>
+        std::pair<std::optional<jsi::Value>, std::optional<jsi::Value>> map_runtime_get_property(
+            jsi::Runtime& runtime, const TMap& map, std::string_view name)
+        {
+            // TODO: Should we also include 'Char' and 'Guid' as well?
+            if constexpr (std::is_same_v<K, winrt::hstring>)
+            {
+                // If the "property" is any other string, then that translates to a 'Lookup' call
+                if (auto value = map_try_lookup(map, current_runtime_context()->map_keys.get(name)))
+                {
+                    return { convert_native_to_value(runtime, *value), std::nullopt };
+                }
+            }
+
+            return { std::nullopt, std::nullopt };
+        }
+
         namespace IMap
         {
             template <typename K, typename V>
@@ -3177,77 +4822,66 @@ namespace rnwinrt
 
                 static constexpr const static_interface_data::property_mapping properties[] = {
                     { "size",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Size());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).Size());
                         },
                         nullptr },
                 };
 
                 static constexpr const static_interface_data::function_mapping functions[] = {
                     { "clear",
-                        [](jsi::Runtime&, const IInspectable& thisValue, const jsi::Value*) {
-                            thisValue.as<native_type>().Clear();
+                        [](jsi::Runtime&, const queried_interface& thisValue, const jsi::Value*) {
+                            interface_cast<native_type>(thisValue).Clear();
                             return jsi::Value::undefined();
                         },
                         0, false },
                     { "getView",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value*) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().GetView());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value*) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).GetView());
                         },
                         0, false },
                     { "hasKey",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto key = convert_value_to_native<K>(runtime, args[0]);
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().HasKey(key));
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).HasKey(key));
                         },
                         1, false },
                     { "insert",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto key = convert_value_to_native<K>(runtime, args[0]);
                             auto value = convert_value_to_native<V>(runtime, args[1]);
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Insert(key, value));
+                            return convert_native_to_value(
+                                runtime, interface_cast<native_type>(thisValue).Insert(key, value));
                         },
                         2, false },
                     { "lookup",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto key = convert_value_to_native<K>(runtime, args[0]);
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Lookup(key));
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).Lookup(key));
                         },
                         1, false },
                     { "remove",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto key = convert_value_to_native<K>(runtime, args[0]);
-                            thisValue.as<native_type>().Remove(key);
+                            interface_cast<native_type>(thisValue).Remove(key);
                             return jsi::Value::undefined();
                         },
                         1, false },
                 };
 
                 static std::pair<std::optional<jsi::Value>, std::optional<jsi::Value>> runtime_get_property(
-                    jsi::Runtime& runtime, const IInspectable& thisValue, std::string_view name)
+                    jsi::Runtime& runtime, const queried_interface& thisValue, std::string_view name)
                 {
-                    // TODO: Should we also include 'Char' and 'Guid' as well?
-                    if constexpr (std::is_same_v<K, winrt::hstring>)
-                    {
-                        // If the "property" is any other string, then that translates to a 'Lookup' call
-                        auto map = thisValue.as<native_type>();
-                        auto key = winrt::to_hstring(name);
-                        if (map.HasKey(key))
-                        {
-                            return { convert_native_to_value(runtime, map.Lookup(key)), std::nullopt };
-                        }
-                    }
-
-                    return { std::nullopt, std::nullopt };
+                    return map_runtime_get_property<K>(runtime, interface_cast<native_type>(thisValue), name);
                 };
 
-                static bool runtime_set_property(jsi::Runtime& runtime, const IInspectable& thisValue,
+                static bool runtime_set_property(jsi::Runtime& runtime, const queried_interface& thisValue,
                     std::string_view name, const jsi::Value& value)
                 {
                     if constexpr (std::is_same_v<K, winrt::hstring>)
                     {
-                        auto map = thisValue.as<native_type>();
-                        auto key = winrt::to_hstring(name);
+                        auto map = interface_cast<native_type>(thisValue);
+                        auto key = current_runtime_context()->map_keys.get(name);
                         map.Insert(key, convert_value_to_native<V>(runtime, value));
                         return true;
                     }
@@ -3278,13 +4912,14 @@ namespace rnwinrt
 
                 static constexpr const static_interface_data::property_mapping properties[] = {
                     { "collectionChange",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().CollectionChange());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                            return convert_native_to_value(
+                                runtime, interface_cast<native_type>(thisValue).CollectionChange());
                         },
                         nullptr },
                     { "key",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Key());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).Key());
                         },
                         nullptr },
                 };
@@ -3311,51 +4946,39 @@ namespace rnwinrt
 
                 static constexpr const static_interface_data::property_mapping properties[] = {
                     { "size",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Size());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).Size());
                         },
                         nullptr },
                 };
 
                 static constexpr const static_interface_data::function_mapping functions[] = {
                     { "hasKey",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto key = convert_value_to_native<K>(runtime, args[0]);
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().HasKey(key));
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).HasKey(key));
                         },
                         1, false },
                     { "lookup",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto key = convert_value_to_native<K>(runtime, args[0]);
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Lookup(key));
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).Lookup(key));
                         },
                         1, false },
                     { "split",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value*) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value*) {
                             winrt::Windows::Foundation::Collections::IMapView<K, V> first;
                             winrt::Windows::Foundation::Collections::IMapView<K, V> second;
-                            thisValue.as<native_type>().Split(first, second);
+                            interface_cast<native_type>(thisValue).Split(first, second);
                             return make_void_return_struct(runtime, "first", first, "second", second);
                         },
                         0, false },
                 };
 
                 static std::pair<std::optional<jsi::Value>, std::optional<jsi::Value>> runtime_get_property(
-                    jsi::Runtime& runtime, const IInspectable& thisValue, std::string_view name)
+                    jsi::Runtime& runtime, const queried_interface& thisValue, std::string_view name)
                 {
-                    // TODO: Should we also include 'Char' and 'Guid' as well?
-                    if constexpr (std::is_same_v<K, winrt::hstring>)
-                    {
-                        // If the "property" is any other string, then that translates to a 'Lookup' call
-                        auto map = thisValue.as<native_type>();
-                        auto key = winrt::to_hstring(name);
-                        if (map.HasKey(key))
-                        {
-                            return { convert_native_to_value(runtime, map.Lookup(key)), std::nullopt };
-                        }
-                    }
-
-                    return { std::nullopt, std::nullopt };
+                    return map_runtime_get_property<K>(runtime, interface_cast<native_type>(thisValue), name);
                 };
             };
 
@@ -3371,6 +4994,163 @@ namespace rnwinrt
             constexpr const static_interface_data& data = data_t<K, V>::value;
         }
 
+        // Returns a JS array holding the contents of 'vector' that is kept in sync with it as it changes. See
+        // 'collection_mirror' for details
+        template <typename T>
+        inline __declspec(noinline) jsi::Value mirror_vector_impl(
+            jsi::Runtime& runtime, const winrt::Windows::Foundation::Collections::IObservableVector<T>& vector)
+        {
+            using namespace winrt::Windows::Foundation::Collections;
+            jsi::Array result(runtime, 0);
+            auto state = std::make_shared<collection_mirror>(runtime, result);
+            state->token = vector.VectorChanged(
+                [state](const IObservableVector<T>& sender, const IVectorChangedEventArgs& args) {
+                    auto change = state->record_change();
+                    auto kind = args.CollectionChange();
+                    auto index = args.Index();
+                    winrt::com_array<T> values;
+                    uint32_t count = 0;
+                    if (kind == CollectionChange::Reset)
+                    {
+                        values = winrt::com_array<T>(sender.Size(), empty_collection_value<T>());
+                        count = sender.GetMany(0, values);
+                    }
+                    else if (kind != CollectionChange::ItemRemoved)
+                    {
+                        values = winrt::com_array<T>(1, sender.GetAt(index));
+                        count = 1;
+                    }
+
+                    state->context->call([state, sender, change, kind, index, count, values = std::move(values)]() {
+                        auto& runtime = state->context->runtime;
+                        bool isAlive;
+                        auto target = state->target(runtime, change, isAlive);
+                        if (!isAlive)
+                        {
+                            sender.VectorChanged(std::exchange(state->token, {}));
+                            return;
+                        }
+                        else if (!target)
+                        {
+                            return;
+                        }
+
+                        auto array = target->getArray(runtime);
+                        auto& spliceFn = current_runtime_context()->builtins.array_splice(runtime);
+                        switch (kind)
+                        {
+                        case CollectionChange::ItemInserted:
+                            spliceFn.callWithThis(runtime, array, static_cast<double>(index), 0,
+                                convert_native_to_value(runtime, values[0]));
+                            break;
+                        case CollectionChange::ItemRemoved:
+                            spliceFn.callWithThis(runtime, array, static_cast<double>(index), 1);
+                            break;
+                        case CollectionChange::ItemChanged:
+                            array.setValueAtIndex(runtime, index, convert_native_to_value(runtime, values[0]));
+                            break;
+                        case CollectionChange::Reset:
+                            array.setProperty(runtime, "length", static_cast<double>(count));
+                            for (uint32_t i = 0; i < count; ++i)
+                            {
+                                array.setValueAtIndex(runtime, i, convert_native_to_value(runtime, values[i]));
+                            }
+                            break;
+                        }
+                    });
+                });
+
+            state->begin_snapshot();
+            vector_for_each(vector, 0, vector.Size(), [&](auto& value, uint32_t index) {
+                result.setValueAtIndex(runtime, index, convert_native_to_value(runtime, value));
+                return true;
+            });
+
+            return result;
+        }
+
+        // Returns a JS object holding the entries of 'map', keyed by the string form of their keys, that is kept in
+        // sync with it as it changes. See 'collection_mirror' for details
+        template <typename K, typename V>
+        inline __declspec(noinline) jsi::Value mirror_map_impl(
+            jsi::Runtime& runtime, const winrt::Windows::Foundation::Collections::IObservableMap<K, V>& map)
+        {
+            using namespace winrt::Windows::Foundation::Collections;
+            jsi::Object result(runtime);
+            auto state = std::make_shared<collection_mirror>(runtime, result);
+            state->token = map.MapChanged(
+                [state](const IObservableMap<K, V>& sender, const IMapChangedEventArgs<K>& args) {
+                    auto change = state->record_change();
+                    auto kind = args.CollectionChange();
+                    std::vector<std::pair<K, V>> entries;
+                    std::optional<K> removedKey;
+                    if (kind == CollectionChange::Reset)
+                    {
+                        entries.reserve(sender.Size());
+                        for (auto&& pair : sender)
+                        {
+                            entries.emplace_back(pair.Key(), pair.Value());
+                        }
+                    }
+                    else if (kind == CollectionChange::ItemRemoved)
+                    {
+                        removedKey = args.Key();
+                    }
+                    else
+                    {
+                        auto key = args.Key();
+                        entries.emplace_back(key, sender.Lookup(key));
+                    }
+
+                    state->context->call([state, sender, change, kind, entries = std::move(entries),
+                                             removedKey = std::move(removedKey)]() {
+                        auto& runtime = state->context->runtime;
+                        bool isAlive;
+                        auto target = state->target(runtime, change, isAlive);
+                        if (!isAlive)
+                        {
+                            sender.MapChanged(std::exchange(state->token, {}));
+                            return;
+                        }
+                        else if (!target)
+                        {
+                            return;
+                        }
+
+                        auto& deleteFn = current_runtime_context()->builtins.reflect_delete_property(runtime);
+                        if (kind == CollectionChange::Reset)
+                        {
+                            auto names = target->getPropertyNames(runtime);
+                            for (size_t i = 0, size = names.size(runtime); i < size; ++i)
+                            {
+                                deleteFn.call(runtime, *target, names.getValueAtIndex(runtime, i));
+                            }
+                        }
+                        else if (removedKey)
+                        {
+                            deleteFn.call(
+                                runtime, *target, convert_native_to_value(runtime, *removedKey).toString(runtime));
+                        }
+
+                        for (auto& [key, value] : entries)
+                        {
+                            target->setProperty(runtime, convert_native_to_value(runtime, key).toString(runtime),
+                                convert_native_to_value(runtime, value));
+                        }
+                    });
+                });
+
+            state->begin_snapshot();
+            iterable_for_each(
+                IIterable<IKeyValuePair<K, V>>(map),
+                [&](auto& pair) {
+                    result.setProperty(runtime, convert_native_to_value(runtime, pair.Key()).toString(runtime),
+                        convert_native_to_value(runtime, pair.Value()));
+                },
+                map.Size());
+            return result;
+        }
+
         namespace IObservableMap
         {
             template <typename K, typename V>
@@ -3380,14 +5160,21 @@ namespace rnwinrt
 
                 static constexpr const static_interface_data::event_mapping events[] = {
                     { "mapchanged",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value& callback) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value& callback) {
                             auto handler = convert_value_to_native<
                                 winrt::Windows::Foundation::Collections::MapChangedEventHandler<K, V>>(
                                 runtime, callback);
-                            return thisValue.as<native_type>().MapChanged(handler);
+                            return interface_cast<native_type>(thisValue).MapChanged(handler);
                         },
-                        [](const IInspectable& thisValue, winrt::event_token token) {
-                            thisValue.as<native_type>().MapChanged(token);
+                        [](const queried_interface& thisValue, winrt::event_token token) {
+                            interface_cast<native_type>(thisValue).MapChanged(token);
+                        } },
+                };
+
+                static constexpr const static_interface_data::function_mapping functions[] = {
+                    { "mirror",
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value*) {
+                            return mirror_map_impl(runtime, interface_cast<native_type>(thisValue));
                         } },
                 };
             };
@@ -3397,7 +5184,7 @@ namespace rnwinrt
             {
                 using iface = interface_data<K, V>;
                 static constexpr const static_interface_data value{ winrt::guid_of<typename iface::native_type>(), {},
-                    iface::events, {} };
+                    iface::events, iface::functions };
             };
 
             template <typename K, typename V>
@@ -3413,14 +5200,21 @@ namespace rnwinrt
 
                 static constexpr const static_interface_data::event_mapping events[] = {
                     { "vectorchanged",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value& callback) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value& callback) {
                             auto handler = convert_value_to_native<
                                 winrt::Windows::Foundation::Collections::VectorChangedEventHandler<T>>(
                                 runtime, callback);
-                            return thisValue.as<native_type>().VectorChanged(handler);
+                            return interface_cast<native_type>(thisValue).VectorChanged(handler);
                         },
-                        [](const IInspectable& thisValue, winrt::event_token token) {
-                            thisValue.as<native_type>().VectorChanged(token);
+                        [](const queried_interface& thisValue, winrt::event_token token) {
+                            interface_cast<native_type>(thisValue).VectorChanged(token);
+                        } },
+                };
+
+                static constexpr const static_interface_data::function_mapping functions[] = {
+                    { "mirror",
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value*) {
+                            return mirror_vector_impl(runtime, interface_cast<native_type>(thisValue));
                         } },
                 };
             };
@@ -3430,7 +5224,7 @@ namespace rnwinrt
             {
                 using iface = interface_data<T>;
                 static constexpr const static_interface_data value{ winrt::guid_of<typename iface::native_type>(), {},
-                    iface::events, {} };
+                    iface::events, iface::functions };
             };
 
             template <typename T>
@@ -3439,8 +5233,7 @@ namespace rnwinrt
 
         inline std::optional<jsi::Value> fwd_array_prototype(jsi::Runtime& runtime, std::string_view name)
         {
-            auto arrayClass = runtime.global().getPropertyAsObject(runtime, "Array");
-            auto arrayProto = arrayClass.getPropertyAsObject(runtime, "prototype");
+            auto& arrayProto = current_runtime_context()->builtins.array_prototype(runtime);
 
             // NOTE: 'name' is constructed from a std::string
             assert(name.data()[name.size()] == 0);
@@ -3509,15 +5302,14 @@ namespace rnwinrt
 
             // TODO: We could in theory try and pre-calculate the final size, but it's not quite clear that would be
             // worth it
-            jsi::Array result(runtime, vector.Size());
-
-            size_t i = 0;
-            for (auto&& value : vector)
-            {
-                result.setValueAtIndex(runtime, i++, convert_native_to_value(runtime, value));
-            }
+            auto size = vector.Size();
+            jsi::Array result(runtime, size);
+            vector_for_each(vector, 0, size, [&](auto& value, uint32_t index) {
+                result.setValueAtIndex(runtime, index, convert_native_to_value(runtime, value));
+                return true;
+            });
 
-            auto pushFn = result.getPropertyAsFunction(runtime, "push");
+            auto& pushFn = current_runtime_context()->builtins.array_push(runtime);
             for (size_t argIndex = 0; argIndex < count; ++argIndex)
             {
                 auto& arg = args[argIndex];
@@ -3545,22 +5337,20 @@ namespace rnwinrt
                         pushFn.callWithThis(runtime, result, arr.getValueAtIndex(runtime, j));
                     }
                 }
-                else if (obj.isHostObject<projected_object_instance>(runtime))
+                else if (auto hostObj = projected_object_instance::from_object(runtime, obj))
                 {
-                    auto hostObj = obj.getHostObject<projected_object_instance>(runtime);
+                    auto pushValue = [&](auto& value, uint32_t) {
+                        pushFn.callWithThis(runtime, result, convert_native_to_value(runtime, value));
+                        return true;
+                    };
+
                     if (auto v = vectorCast(hostObj->instance()))
                     {
-                        for (auto&& value : v)
-                        {
-                            pushFn.callWithThis(runtime, result, convert_native_to_value(runtime, value));
-                        }
+                        vector_for_each(v, 0, v.Size(), pushValue);
                     }
                     else if (auto view = vectorViewCast(hostObj->instance()))
                     {
-                        for (auto&& value : v)
-                        {
-                            pushFn.callWithThis(runtime, result, convert_native_to_value(runtime, value));
-                        }
+                        vector_for_each(view, 0, view.Size(), pushValue);
                     }
                     // TODO: IIterable?
                     else
@@ -3600,25 +5390,21 @@ namespace rnwinrt
             auto fn = callback_from_arg(runtime, args, count);
             auto thisArg = callback_this_arg(runtime, args, count);
 
-            double index = 0;
-            for (auto&& value : vector)
-            {
+            return vector_for_each(vector, 0, vector.Size(), [&](auto& value, uint32_t index) {
                 jsi::Value result;
                 if (thisArg)
                 {
-                    result =
-                        fn.callWithThis(runtime, *thisArg, convert_native_to_value(runtime, value), index++, thisValue);
+                    result = fn.callWithThis(runtime, *thisArg, convert_native_to_value(runtime, value),
+                        static_cast<double>(index), thisValue);
                 }
                 else
                 {
-                    result = fn.call(runtime, convert_native_to_value(runtime, value), index++, thisValue);
+                    result = fn.call(
+                        runtime, convert_native_to_value(runtime, value), static_cast<double>(index), thisValue);
                 }
 
-                if (!to_boolean(runtime, result))
-                    return false;
-            }
-
-            return true;
+                return to_boolean(runtime, result);
+            });
         }
 
         template <typename TVector>
@@ -3640,27 +5426,28 @@ namespace rnwinrt
             auto thisArg = callback_this_arg(runtime, args, count);
 
             jsi::Array result(runtime, 0);
-            auto pushFn = result.getPropertyAsFunction(runtime, "push");
+            auto& pushFn = current_runtime_context()->builtins.array_push(runtime);
 
-            double index = 0;
-            for (auto&& value : vector)
-            {
+            vector_for_each(vector, 0, vector.Size(), [&](auto& value, uint32_t index) {
                 jsi::Value includeResult;
                 if (thisArg)
                 {
-                    includeResult =
-                        fn.callWithThis(runtime, *thisArg, convert_native_to_value(runtime, value), index++, thisValue);
+                    includeResult = fn.callWithThis(runtime, *thisArg, convert_native_to_value(runtime, value),
+                        static_cast<double>(index), thisValue);
                 }
                 else
                 {
-                    includeResult = fn.call(runtime, convert_native_to_value(runtime, value), index++, thisValue);
+                    includeResult = fn.call(
+                        runtime, convert_native_to_value(runtime, value), static_cast<double>(index), thisValue);
                 }
 
                 if (to_boolean(runtime, includeResult))
                 {
                     pushFn.callWithThis(runtime, result, convert_native_to_value(runtime, value));
                 }
-            }
+
+                return true;
+            });
 
             return result;
         }
@@ -3683,18 +5470,19 @@ namespace rnwinrt
             auto fn = callback_from_arg(runtime, args, count);
             auto thisArg = callback_this_arg(runtime, args, count);
 
-            double index = 0;
-            for (auto&& value : vector)
-            {
+            vector_for_each(vector, 0, vector.Size(), [&](auto& value, uint32_t index) {
                 if (thisArg)
                 {
-                    fn.callWithThis(runtime, *thisArg, convert_native_to_value(runtime, value), index++, thisValue);
+                    fn.callWithThis(runtime, *thisArg, convert_native_to_value(runtime, value),
+                        static_cast<double>(index), thisValue);
                 }
                 else
                 {
-                    fn.call(runtime, convert_native_to_value(runtime, value), index++, thisValue);
+                    fn.call(runtime, convert_native_to_value(runtime, value), static_cast<double>(index), thisValue);
                 }
-            }
+
+                return true;
+            });
 
             return jsi::Value::undefined();
         }
@@ -3735,14 +5523,21 @@ namespace rnwinrt
                 }
             }
 
-            for (; fromIndex >= 0; --fromIndex)
-            {
-                if (jsi::Value::strictEquals(runtime, args[0],
-                        convert_native_to_value(runtime, vector.GetAt(static_cast<uint32_t>(fromIndex)))))
-                    return static_cast<double>(fromIndex);
-            }
+            if (fromIndex < 0)
+                return -1;
+
+            double result = -1;
+            vector_for_each_reverse(vector, 0, static_cast<uint32_t>(fromIndex + 1), [&](auto& value, uint32_t index) {
+                if (jsi::Value::strictEquals(runtime, args[0], convert_native_to_value(runtime, value)))
+                {
+                    result = static_cast<double>(index);
+                    return false;
+                }
+
+                return true;
+            });
 
-            return -1;
+            return result;
         }
 
         template <typename TVector>
@@ -3762,10 +5557,9 @@ namespace rnwinrt
             auto fn = callback_from_arg(runtime, args, count);
             auto thisArg = callback_this_arg(runtime, args, count);
 
-            jsi::Array result(runtime, vector.Size());
-            uint32_t index = 0;
-            for (auto&& value : vector)
-            {
+            auto size = vector.Size();
+            jsi::Array result(runtime, size);
+            vector_for_each(vector, 0, size, [&](auto& value, uint32_t index) {
                 jsi::Value mapResult;
                 if (thisArg)
                 {
@@ -3779,8 +5573,8 @@ namespace rnwinrt
                 }
 
                 result.setValueAtIndex(runtime, index, std::move(mapResult));
-                ++index;
-            }
+                return true;
+            });
 
             return result;
         }
@@ -3819,11 +5613,11 @@ namespace rnwinrt
                 accum = convert_native_to_value(runtime, vector.GetAt(i++));
             }
 
-            for (; i < size; ++i)
-            {
-                accum = fn.call(runtime, accum, convert_native_to_value(runtime, vector.GetAt(i)),
-                    static_cast<double>(i), thisValue);
-            }
+            vector_for_each(vector, i, size, [&](auto& value, uint32_t index) {
+                accum = fn.call(
+                    runtime, accum, convert_native_to_value(runtime, value), static_cast<double>(index), thisValue);
+                return true;
+            });
 
             return accum;
         }
@@ -3862,11 +5656,11 @@ namespace rnwinrt
                 accum = convert_native_to_value(runtime, vector.GetAt(--i));
             }
 
-            while (i-- > 0)
-            {
-                accum = fn.call(runtime, accum, convert_native_to_value(runtime, vector.GetAt(i)),
-                    static_cast<double>(i), thisValue);
-            }
+            vector_for_each_reverse(vector, 0, i, [&](auto& value, uint32_t index) {
+                accum = fn.call(
+                    runtime, accum, convert_native_to_value(runtime, value), static_cast<double>(index), thisValue);
+                return true;
+            });
 
             return accum;
         }
@@ -3894,10 +5688,10 @@ namespace rnwinrt
 
             auto copySize = end - start;
             jsi::Array result(runtime, copySize);
-            for (size_t i = 0; start < end; ++i, ++start)
-            {
-                result.setValueAtIndex(runtime, i, convert_native_to_value(runtime, vector.GetAt(start)));
-            }
+            vector_for_each(vector, start, end, [&](auto& value, uint32_t index) {
+                result.setValueAtIndex(runtime, index - start, convert_native_to_value(runtime, value));
+                return true;
+            });
 
             return result;
         }
@@ -3919,25 +5713,21 @@ namespace rnwinrt
             auto fn = callback_from_arg(runtime, args, count);
             auto thisArg = callback_this_arg(runtime, args, count);
 
-            double index = 0;
-            for (auto&& value : vector)
-            {
+            return !vector_for_each(vector, 0, vector.Size(), [&](auto& value, uint32_t index) {
                 jsi::Value result;
                 if (thisArg)
                 {
-                    result =
-                        fn.callWithThis(runtime, *thisArg, convert_native_to_value(runtime, value), index++, thisValue);
+                    result = fn.callWithThis(runtime, *thisArg, convert_native_to_value(runtime, value),
+                        static_cast<double>(index), thisValue);
                 }
                 else
                 {
-                    result = fn.call(runtime, convert_native_to_value(runtime, value), index++, thisValue);
+                    result = fn.call(
+                        runtime, convert_native_to_value(runtime, value), static_cast<double>(index), thisValue);
                 }
 
-                if (to_boolean(runtime, result))
-                    return true;
-            }
-
-            return false;
+                return !to_boolean(runtime, result);
+            });
         }
 
         template <typename TVector>
@@ -3959,12 +5749,12 @@ namespace rnwinrt
 
                 static constexpr const static_interface_data::property_mapping properties[] = {
                     { "length", // NOTE: From Array.prototype
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Size());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).Size());
                         },
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value& value) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value& value) {
                             // Following Chakra's behavior, setting the length can only be used to remove elements
-                            auto vector = thisValue.as<native_type>();
+                            auto vector = interface_cast<native_type>(thisValue);
                             auto currLen = vector.Size();
                             auto newLen = convert_value_to_native<uint32_t>(runtime, value);
                             if (newLen > currLen)
@@ -3985,86 +5775,87 @@ namespace rnwinrt
                             }
                         } },
                     { "size",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Size());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).Size());
                         },
                         nullptr },
                 };
 
                 static constexpr const static_interface_data::function_mapping functions[] = {
                     { "append",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto value = convert_value_to_native<T>(runtime, args[0]);
-                            thisValue.as<native_type>().Append(value);
+                            interface_cast<native_type>(thisValue).Append(value);
                             return jsi::Value::undefined();
                         },
                         1, false },
                     { "clear",
-                        [](jsi::Runtime&, const IInspectable& thisValue, const jsi::Value*) {
-                            thisValue.as<native_type>().Clear();
+                        [](jsi::Runtime&, const queried_interface& thisValue, const jsi::Value*) {
+                            interface_cast<native_type>(thisValue).Clear();
                             return jsi::Value::undefined();
                         },
                         0, false },
                     { "getAt",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto index = convert_value_to_native<uint32_t>(runtime, args[0]);
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().GetAt(index));
+                            return convert_native_to_value(
+                                runtime, interface_cast<native_type>(thisValue).GetAt(index));
                         },
                         1, false },
                     { "getMany",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto startIndex = convert_value_to_native<uint32_t>(runtime, args[0]);
                             auto items = convert_value_to_native<winrt::array_view<T>>(runtime, args[1]);
                             return convert_native_to_value(
-                                runtime, thisValue.as<native_type>().GetMany(startIndex, items));
+                                runtime, interface_cast<native_type>(thisValue).GetMany(startIndex, items));
                         },
                         2, false },
                     { "getView",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value*) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().GetView());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value*) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).GetView());
                         },
                         0, false },
                     { "indexOf",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto value = convert_value_to_native<T>(runtime, args[0]);
                             uint32_t index;
-                            auto returnValue = thisValue.as<native_type>().IndexOf(value, index);
+                            auto returnValue = interface_cast<native_type>(thisValue).IndexOf(value, index);
                             return make_return_struct(runtime, returnValue, "index", index);
                         },
                         1, false },
                     { "insertAt",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto index = convert_value_to_native<uint32_t>(runtime, args[0]);
                             auto value = convert_value_to_native<T>(runtime, args[1]);
-                            thisValue.as<native_type>().InsertAt(index, value);
+                            interface_cast<native_type>(thisValue).InsertAt(index, value);
                             return jsi::Value::undefined();
                         },
                         2, false },
                     { "removeAt",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto index = convert_value_to_native<uint32_t>(runtime, args[0]);
-                            thisValue.as<native_type>().RemoveAt(index);
+                            interface_cast<native_type>(thisValue).RemoveAt(index);
                             return jsi::Value::undefined();
                         },
                         1, false },
                     { "removeAtEnd",
-                        [](jsi::Runtime&, const IInspectable& thisValue, const jsi::Value*) {
-                            thisValue.as<native_type>().RemoveAtEnd();
+                        [](jsi::Runtime&, const queried_interface& thisValue, const jsi::Value*) {
+                            interface_cast<native_type>(thisValue).RemoveAtEnd();
                             return jsi::Value::undefined();
                         },
                         0, false },
                     { "replaceAll",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto items = convert_value_to_native<winrt::array_view<const T>>(runtime, args[0]);
-                            thisValue.as<native_type>().ReplaceAll(items);
+                            interface_cast<native_type>(thisValue).ReplaceAll(items);
                             return jsi::Value::undefined();
                         },
                         1, false },
                     { "setAt",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto index = convert_value_to_native<uint32_t>(runtime, args[0]);
                             auto value = convert_value_to_native<T>(runtime, args[1]);
-                            thisValue.as<native_type>().SetAt(index, value);
+                            interface_cast<native_type>(thisValue).SetAt(index, value);
                             return jsi::Value::undefined();
                         },
                         2, false },
@@ -4232,10 +6023,10 @@ namespace rnwinrt
 
                         std::vector<jsi::Value> values;
                         values.reserve(size);
-                        for (auto&& value : vector)
-                        {
+                        vector_for_each(vector, 0, size, [&](auto& value, uint32_t) {
                             values.push_back(convert_native_to_value(runtime, value));
-                        }
+                            return true;
+                        });
 
                         std::stable_sort(values.begin(), values.end(), [&](auto&& lhs, auto&& rhs) {
                             return to_number(runtime, compareFn.call(runtime, lhs, rhs)) < 0;
@@ -4251,12 +6042,12 @@ namespace rnwinrt
                         // Default is to sort 'toString' representations
                         std::vector<std::pair<std::u16string, T>> values;
                         values.reserve(size);
-                        for (auto value : vector)
-                        {
+                        vector_for_each(vector, 0, size, [&](auto& value, uint32_t) {
                             values.emplace_back(
                                 string_to_utf16(runtime, convert_native_to_value(runtime, value).toString(runtime)),
                                 std::move(value));
-                        }
+                            return true;
+                        });
 
                         std::stable_sort(values.begin(), values.end(),
                             [&](auto&& lhs, auto&& rhs) { return lhs.first < rhs.first; });
@@ -4413,8 +6204,9 @@ namespace rnwinrt
                 };
 
                 static std::pair<std::optional<jsi::Value>, std::optional<jsi::Value>> runtime_get_property_impl(
-                    jsi::Runtime& runtime, const IInspectable& thisValue, std::string_view name,
-                    span<const array_proto_functions_t> protoFunctions, native_type (*queryThis)(const IInspectable&))
+                    jsi::Runtime& runtime, const queried_interface& thisValue, std::string_view name,
+                    span<const array_proto_functions_t> protoFunctions,
+                    native_type (*queryThis)(const queried_interface&))
                 {
                     // If the "property" is a number, then that translates to a 'GetAt' call
                     if (auto index = index_from_name(name))
@@ -4441,19 +6233,19 @@ namespace rnwinrt
                 }
 
                 static std::pair<std::optional<jsi::Value>, std::optional<jsi::Value>> runtime_get_property(
-                    jsi::Runtime& runtime, const IInspectable& thisValue, std::string_view name)
+                    jsi::Runtime& runtime, const queried_interface& thisValue, std::string_view name)
                 {
                     return runtime_get_property_impl(runtime, thisValue, name, array_proto_functions,
-                        [](const IInspectable& thisVal) { return thisVal.as<native_type>(); });
+                        [](const queried_interface& thisVal) { return interface_cast<native_type>(thisVal); });
                 }
 
-                static bool runtime_set_property(jsi::Runtime& runtime, const IInspectable& thisValue,
+                static bool runtime_set_property(jsi::Runtime& runtime, const queried_interface& thisValue,
                     std::string_view name, const jsi::Value& value)
                 {
                     // If the "property" is a number, then that translates to a 'SetAt' call
                     if (auto index = index_from_name(name))
                     {
-                        auto vector = thisValue.as<native_type>();
+                        auto vector = interface_cast<native_type>(thisValue);
                         if (*index == vector.Size())
                         {
                             // Following Chakra's behavior, assigning to one-past the end appends
@@ -4493,37 +6285,38 @@ namespace rnwinrt
 
                 static constexpr const static_interface_data::property_mapping properties[] = {
                     { "length", // NOTE: From Array.prototype
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Size());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).Size());
                         },
                         nullptr },
                     { "size",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue) {
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().Size());
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue) {
+                            return convert_native_to_value(runtime, interface_cast<native_type>(thisValue).Size());
                         },
                         nullptr },
                 };
 
                 static constexpr const static_interface_data::function_mapping functions[] = {
                     { "getAt",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto index = convert_value_to_native<uint32_t>(runtime, args[0]);
-                            return convert_native_to_value(runtime, thisValue.as<native_type>().GetAt(index));
+                            return convert_native_to_value(
+                                runtime, interface_cast<native_type>(thisValue).GetAt(index));
                         },
                         1, false },
                     { "getMany",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto startIndex = convert_value_to_native<uint32_t>(runtime, args[0]);
                             auto items = convert_value_to_native<winrt::array_view<T>>(runtime, args[1]);
                             return convert_native_to_value(
-                                runtime, thisValue.as<native_type>().GetMany(startIndex, items));
+                                runtime, interface_cast<native_type>(thisValue).GetMany(startIndex, items));
                         },
                         2, false },
                     { "indexOf",
-                        [](jsi::Runtime& runtime, const IInspectable& thisValue, const jsi::Value* args) {
+                        [](jsi::Runtime& runtime, const queried_interface& thisValue, const jsi::Value* args) {
                             auto value = convert_value_to_native<T>(runtime, args[0]);
                             uint32_t index;
-                            auto returnValue = thisValue.as<native_type>().IndexOf(value, index);
+                            auto returnValue = interface_cast<native_type>(thisValue).IndexOf(value, index);
                             return make_return_struct(runtime, returnValue, "index", index);
                         },
                         1, false },
@@ -4580,8 +6373,9 @@ namespace rnwinrt
                 };
 
                 static std::pair<std::optional<jsi::Value>, std::optional<jsi::Value>> runtime_get_property_impl(
-                    jsi::Runtime& runtime, const IInspectable& thisValue, std::string_view name,
-                    span<const array_proto_functions_t> protoFunctions, native_type (*queryThis)(const IInspectable&))
+                    jsi::Runtime& runtime, const queried_interface& thisValue, std::string_view name,
+                    span<const array_proto_functions_t> protoFunctions,
+                    native_type (*queryThis)(const queried_interface&))
                 {
                     // If the "property" is a number, then that translates to a 'GetAt' call
                     if (auto index = index_from_name(name))
@@ -4608,10 +6402,10 @@ namespace rnwinrt
                 }
 
                 static std::pair<std::optional<jsi::Value>, std::optional<jsi::Value>> runtime_get_property(
-                    jsi::Runtime& runtime, const IInspectable& thisValue, std::string_view name)
+                    jsi::Runtime& runtime, const queried_interface& thisValue, std::string_view name)
                 {
                     return runtime_get_property_impl(runtime, thisValue, name, array_proto_functions,
-                        [](const IInspectable& thisVal) { return thisVal.as<native_type>(); });
+                        [](const queried_interface& thisVal) { return interface_cast<native_type>(thisVal); });
                 }
             };
 
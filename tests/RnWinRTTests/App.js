@@ -27,6 +27,8 @@ import { makeDelegateAndEventTestScenarios } from './DelegateAndEventTests'
 import { makeAsyncTestScenarios } from './AsyncTests'
 import { makeCollectionsTestScenarios } from './CollectionsTests'
 import { makeInheritanceTestScenarios } from './InheritanceTests'
+import { makeProjectionTestScenarios } from './ProjectionTests'
+import { testConfiguration } from './TestOptions'
 
 class App extends Component {
     test = new TestComponent.Test();
@@ -59,6 +61,9 @@ class App extends Component {
         }, {
             name: "Inheritance Tests",
             scenarios: makeInheritanceTestScenarios(this),
+        }, {
+            name: "Projection Tests",
+            scenarios: makeProjectionTestScenarios(this),
         }
     ]
 
@@ -179,7 +184,7 @@ class App extends Component {
         return (
             <SafeAreaView style={{ flex: 1, backgroundColor: 'white' }}>
                 <View style={styles.headerBanner}>
-                    <Text style={{ fontSize: 22 }}>WinRT Projection Tests</Text>
+                    <Text style={{ fontSize: 22 }}>WinRT Projection Tests ({testConfiguration})</Text>
                 </View>
                 <ScrollView style={styles.scrollView}>
                     <View style={[styles.listEntry, { alignSelf: 'center' }]}>
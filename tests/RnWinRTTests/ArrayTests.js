@@ -12,6 +12,7 @@ import {
     guidFromString,
     makeGuid
 } from './TestCommon'
+import { testOptions } from './TestOptions'
 
 export function makeArrayTestScenarios(pThis) {
     return [
@@ -58,6 +59,21 @@ export function makeArrayTestScenarios(pThis) {
         new TestScenario('Test::CompositeStructFillParam', runCompositeStructFillParam.bind(pThis)),
         new TestScenario('Test::RefFillParam', runRefFillParam.bind(pThis)),
         new TestScenario('Test::ObjectFillParam', runObjectFillParam.bind(pThis)),
+
+        // Typed array inputs
+        new TestScenario('Test::NumericArrayOutParam (Int32Array)', runNumericTypedArrayOutParam.bind(pThis)),
+        new TestScenario('Test::NumericArrayOutParam (ArrayBuffer)', runNumericArrayBufferOutParam.bind(pThis)),
+        new TestScenario('Test::NumericFillParam (Int32Array)', runNumericTypedArrayFillParam.bind(pThis)),
+
+        // Typed array results
+        new TestScenario('Test::StaticReverseNumericArray', runStaticReverseNumericArray.bind(pThis)),
+        new TestScenario('Test::StaticCopyByteArray', runStaticCopyByteArray.bind(pThis)),
+        new TestScenario('Test::NumericArrayOutParam (typed array results)', runNumericArrayOutParamTypedResults.bind(pThis)),
+        new TestScenario('Test::NumericArrayProperty (typed array results)', runNumericArrayPropertyTypedResults.bind(pThis)),
+
+        // Buffer params
+        new TestScenario('Test::CreateBuffer', runCreateBuffer.bind(pThis)),
+        new TestScenario('Test::FillBuffer', runFillBuffer.bind(pThis)),
     ];
 }
 
@@ -453,6 +469,173 @@ function runNumericFillParam(scenario) {
     })
 }
 
+function runNumericTypedArrayOutParam(scenario) {
+    this.runSync(scenario, () => {
+        var fn = (val) => this.test.numericArrayOutParam(val);
+        validateArrayOutParam(new Int32Array([ 0, 1, 2, 3, 4 ]), fn);
+
+        // Views into a larger buffer should only pass the viewed elements
+        var buffer = new Int32Array([ 42, 0, 1, 2, 3, 4, 42 ]).buffer;
+        validateArrayOutParam(new Int32Array(buffer, 4, 5), fn);
+    });
+}
+
+function runNumericArrayBufferOutParam(scenario) {
+    this.runSync(scenario, () => {
+        var arr = new Int32Array([ 0, 1, 2, 3, 4 ]);
+        var { returnValue, rot1, rot2 } = this.test.numericArrayOutParam(arr.buffer);
+        validateRotatedArray(arr, rot1, 1);
+        validateRotatedArray(arr, rot2, 2);
+        validateReversedArray(arr, returnValue);
+    });
+}
+
+function runNumericTypedArrayFillParam(scenario) {
+    this.runSync(scenario, () => {
+        var run = (size) => {
+            var arr = new Int32Array(size);
+            this.test.numericFillParam(arr);
+
+            var expect = 0;
+            for (var val of arr) {
+                assert.equal(val, expect++);
+            }
+        };
+        run(0);
+        run(1);
+        run(2);
+        run(100);
+    })
+}
+
+// NOTE: Arrays of primitive types are only projected as typed arrays when the 'typedArrays' option is set
+function validateArrayResultType(value, typedArrayType) {
+    if (testOptions.typedArrays) {
+        assert.isTrue(value instanceof typedArrayType);
+    } else {
+        assert.isTrue(Array.isArray(value));
+    }
+}
+
+function runStaticReverseNumericArray(scenario) {
+    this.runSync(scenario, () => {
+        // NOTE: Return values are moved into the projection, so the typed array can use the array's memory directly
+        for (var arr of TestValues.s32.validArrays) {
+            var result = TestComponent.Test.staticReverseNumericArray(arr);
+            validateArrayResultType(result, Int32Array);
+            validateReversedArray(arr, result);
+        }
+
+        // The result must stay valid after other calls, and must be writable like any other typed array
+        var first = TestComponent.Test.staticReverseNumericArray([1, 2, 3]);
+        var second = TestComponent.Test.staticReverseNumericArray([4, 5, 6]);
+        first[0] = 42;
+        assert.equal(Array.from(first), [42, 2, 1]);
+        assert.equal(Array.from(second), [6, 5, 4]);
+
+        // Results can be passed back to WinRT
+        assert.equal(TestComponent.Test.staticAddAll(first), 45);
+    });
+}
+
+function runStaticCopyByteArray(scenario) {
+    this.runSync(scenario, () => {
+        var arr = [];
+        for (var i = 0; i < 256; ++i) {
+            arr.push(i);
+        }
+
+        var result = TestComponent.Test.staticCopyByteArray(arr);
+        validateArrayResultType(result, Uint8Array);
+        assert.equal(Array.from(result), arr);
+        if (testOptions.typedArrays) {
+            assert.equal(result.byteLength, 256);
+            assert.equal(result.byteOffset, 0);
+        }
+    });
+}
+
+function runNumericArrayOutParamTypedResults(scenario) {
+    this.runSync(scenario, () => {
+        var arr = [0, 1, 2, 3, 4];
+        var { returnValue, rot1, rot2 } = this.test.numericArrayOutParam(arr);
+        validateArrayResultType(returnValue, Int32Array);
+        validateArrayResultType(rot1, Int32Array);
+        validateArrayResultType(rot2, Int32Array);
+        validateArrayOutParam(arr, (val) => this.test.numericArrayOutParam(val));
+    });
+}
+
+function runNumericArrayPropertyTypedResults(scenario) {
+    this.runSync(scenario, () => {
+        var test = new TestComponent.Test();
+        test.numericArrayProperty = [1, 2, 3];
+        var value = test.numericArrayProperty;
+        validateArrayResultType(value, Int32Array);
+        assert.equal(Array.from(value), [1, 2, 3]);
+
+        // Typed arrays can be assigned back
+        test.numericArrayProperty = new Int32Array([4, 5]);
+        assert.equal(Array.from(test.numericArrayProperty), [4, 5]);
+    });
+}
+
+function runCreateBuffer(scenario) {
+    this.runSync(scenario, () => {
+        var buffer = this.test.createBuffer(100);
+
+        // NOTE: Buffers are only projected as ArrayBuffers when the 'buffersAsArrayBuffers' option is set
+        if (testOptions.buffersAsArrayBuffers) {
+            assert.isTrue(buffer instanceof ArrayBuffer);
+            assert.equal(buffer.byteLength, 100);
+            var expect = 0;
+            for (var val of new Uint8Array(buffer)) {
+                assert.equal(val, expect++);
+            }
+
+            // The ArrayBuffer is passed back without copying, so the callee writes into the same memory
+            new Uint8Array(buffer).fill(0);
+            this.test.fillBuffer(buffer);
+            expect = 0;
+            for (var val of new Uint8Array(buffer)) {
+                assert.equal(val, expect++);
+            }
+        } else {
+            assert.isTrue(!(buffer instanceof ArrayBuffer));
+            assert.equal(buffer.length, 100);
+        }
+
+        // Either way, the value should be usable as an IBuffer
+        this.test.fillBuffer(buffer);
+    });
+}
+
+function runFillBuffer(scenario) {
+    this.runSync(scenario, () => {
+        var validate = (arr) => {
+            var expect = 0;
+            for (var val of arr) {
+                assert.equal(val, expect++);
+            }
+        };
+
+        var arr = new Uint8Array(100);
+        this.test.fillBuffer(arr);
+        validate(arr);
+
+        var buffer = new ArrayBuffer(50);
+        this.test.fillBuffer(buffer);
+        validate(new Uint8Array(buffer));
+
+        // Writes through a view should only touch the viewed bytes
+        var outer = new Uint8Array(20).fill(42);
+        this.test.fillBuffer(new DataView(outer.buffer, 5, 10));
+        validate(outer.subarray(5, 15));
+        assert.equal(outer[4], 42);
+        assert.equal(outer[15], 42);
+    });
+}
+
 function runStringFillParam(scenario) {
     this.runSync(scenario, () => {
         var run = (size) => {
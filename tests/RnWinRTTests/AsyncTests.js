@@ -9,6 +9,8 @@ import {
     TestScenario,
     assert,
 } from './TestCommon'
+import { testOptions } from './TestOptions'
+import WinRTTurboModule from './WinRTTurboModule'
 
 export function makeAsyncTestScenarios(pThis) {
     return [
@@ -16,9 +18,14 @@ export function makeAsyncTestScenarios(pThis) {
         new TestScenario('Test::CountToNumberAsync', runAsyncActionWithProgressTest.bind(pThis)),
         new TestScenario('Test::AddAsync', runAsyncOperationTest.bind(pThis)),
         new TestScenario('Test::CountDoubleAsync', runAsyncOperationWithProgressTest.bind(pThis)),
+        new TestScenario('Test::ReportProgressBurstAsync', runProgressBurstTest.bind(pThis)),
+        new TestScenario('Throttled progress', runThrottledProgressTest.bind(pThis)),
         new TestScenario('Test::ThrowAsyncException', runAsyncActionWithException.bind(pThis)),
+        new TestScenario('Test::ImmediateReturnAsync', runCompletedAsyncOperationTest.bind(pThis)),
+        new TestScenario('Async continuation order', runContinuationOrderTest.bind(pThis)),
         new TestScenario('Async await', runAsyncAwaitTest.bind(pThis)),
         new TestScenario('Test::GetObjectsAsync', runGetObjectsTest.bind(pThis)),
+        new TestScenario('WinRTTurboModule::createStreamReader', runStreamReaderTest.bind(pThis)),
     ];
 }
 
@@ -133,6 +140,54 @@ function runAsyncOperationTest(scenario) {
     });
 }
 
+function runCompletedAsyncOperationTest(scenario) {
+    this.runAsync(scenario, (resolve, reject) => {
+        // The operation has already completed when it's returned, however continuations must still run asynchronously
+        // and in the order they were added
+        var order = [];
+        var op = TestComponent.Test.immediateReturnAsync(42);
+        var first = op.then(val => { order.push(1); return val; });
+        var second = op.finally(() => order.push(2));
+        op.done(val => order.push(3));
+        assert.equal(0, order.length);
+
+        // Continuations are handled by the engine's Promise implementation
+        assert.isTrue(first instanceof Promise);
+        assert.isTrue(second instanceof Promise);
+
+        Promise.all([first, second]).then(values => {
+            assert.equal(42, values[0]);
+            assert.equal(42, values[1]);
+            assert.equal('1,2,3', order.join());
+            resolve();
+        }).catch(reject);
+    });
+}
+
+function runContinuationOrderTest(scenario) {
+    this.runAsync(scenario, (resolve, reject) => {
+        // Callbacks passed to 'done' are invoked in the order they were added relative to 'then', 'catch', and
+        // 'finally' callbacks, both for operations that complete successfully and for those that fail
+        var order = [];
+        var op = TestComponent.Test.addAsync(20, 22);
+        op.then(() => order.push('then'));
+        op.done(val => order.push('done:' + val));
+        var last = op.finally(() => order.push('finally'));
+
+        var failedOrder = [];
+        var failedOp = TestComponent.Test.throwAsyncException();
+        failedOp.catch(() => failedOrder.push('catch'));
+        failedOp.done(() => failedOrder.push('resolved'), () => failedOrder.push('done'));
+        var failedLast = failedOp.catch(() => failedOrder.push('catch'));
+
+        Promise.all([last, failedLast]).then(() => {
+            assert.equal('then,done:42,finally', order.join());
+            assert.equal('catch,done,catch', failedOrder.join());
+            resolve();
+        }).catch(reject);
+    });
+}
+
 function runAsyncOperationWithProgressTest(scenario) {
     this.runAsync(scenario, (resolve, reject) => {
         Promise.all([
@@ -180,6 +235,70 @@ function runAsyncOperationWithProgressTest(scenario) {
     });
 }
 
+function runProgressBurstTest(scenario) {
+    this.runAsync(scenario, (resolve, reject) => {
+        // Progress gets coalesced, so we should only see a subset of the reports, but always in order and always ending
+        // with the final report
+        const count = 10000;
+        var reports = 0;
+        var lastProgress = -1;
+        var pass = true;
+        TestComponent.Test.reportProgressBurstAsync(count).done(
+            () => {
+                try {
+                    assert.isTrue(pass);
+                    assert.isTrue(reports <= count);
+                    // NOTE: The final report is always delivered before completion, even when it was coalesced
+                    assert.equal(count, lastProgress);
+                    resolve();
+                } catch (err) {
+                    reject(err);
+                }
+            }, reject, val => {
+                ++reports;
+                if (val <= lastProgress) pass = false;
+                lastProgress = val;
+            });
+    });
+}
+
+function runThrottledProgressTest(scenario) {
+    this.runAsync(scenario, (resolve, reject) => {
+        // The whole burst gets reported well within a single throttle interval, so with a throttle we should see the
+        // first report and then the final one, which would otherwise still be waiting on the throttle at completion
+        const count = 1000;
+        var reports = [];
+        var completed = false;
+        TestComponent.Test.reportProgressBurstAsync(count).done(
+            () => {
+                completed = true;
+                try {
+                    assert.equal(count, reports[reports.length - 1]);
+                    if (testOptions.progressThrottleMs) {
+                        assert.isTrue(reports.length <= 2);
+                    }
+                } catch (err) {
+                    reject(err);
+                    return;
+                }
+
+                // Progress must not be reported after completion
+                var reportCount = reports.length;
+                setTimeout(() => {
+                    try {
+                        assert.equal(reportCount, reports.length);
+                        resolve();
+                    } catch (err) {
+                        reject(err);
+                    }
+                }, (testOptions.progressThrottleMs || 0) + 100);
+            }, reject, val => {
+                if (completed) reject(new Error('Progress reported after completion'));
+                reports.push(val);
+            });
+    });
+}
+
 function runAsyncActionWithException(scenario) {
     this.runAsync(scenario, (resolve, reject) => {
         Promise.all([
@@ -273,3 +392,55 @@ function runGetObjectsTest(scenario) {
         }
     });
 }
+
+function runStreamReaderTest(scenario) {
+    this.runAsync(scenario, async (resolve, reject) => {
+        try
+        {
+            const length = 100000;
+            var stream = await TestComponent.Test.createInputStreamAsync(length);
+            var total = 0;
+            for await (const chunk of WinRTTurboModule.createStreamReader(stream, { chunkSize: 4096 })) {
+                assert.isTrue(chunk.byteLength <= 4096);
+                for (var val of new Uint8Array(chunk)) {
+                    assert.equal(total++ & 0xFF, val);
+                }
+            }
+            assert.equal(length, total);
+
+            // Exiting the loop early should stop the reader
+            stream = await TestComponent.Test.createInputStreamAsync(length);
+            for await (const chunk of WinRTTurboModule.createStreamReader(stream, { chunkSize: 1000, readAhead: 1 })) {
+                assert.equal(1000, chunk.byteLength);
+                break;
+            }
+
+            // Reads that have already completed when 'ReadAsync' returns should be handled the same way as any other
+            total = 0;
+            stream = TestComponent.Test.createSynchronousInputStream(length);
+            for await (const chunk of WinRTTurboModule.createStreamReader(stream, { chunkSize: 1000, readAhead: 8 })) {
+                assert.equal(1000, chunk.byteLength);
+                for (var val of new Uint8Array(chunk)) {
+                    assert.equal(total++ & 0xFF, val);
+                }
+            }
+            assert.equal(length, total);
+
+            // Errors that the stream throws synchronously from 'ReadAsync' should reject the request, after which the
+            // reader is done
+            var reader = WinRTTurboModule.createStreamReader(TestComponent.Test.createFailingInputStream());
+            var error = null;
+            try {
+                await reader.next();
+            } catch (err) {
+                error = err;
+            }
+            assert.isTrue(error !== null);
+            assert.isTrue((await reader.next()).done);
+
+            resolve();
+        } catch (err) {
+            reject(err);
+        }
+    });
+}
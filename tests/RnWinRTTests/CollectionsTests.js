@@ -113,6 +113,10 @@ export function makeCollectionsTestScenarios(pThis) {
         // Observable collections
         new TestScenario('IObservableVector<Int32>', runObservableVectorTest.bind(pThis)),
         new TestScenario('IObservableMap<Int32>', runObservableMapTest.bind(pThis)),
+        new TestScenario('IObservableVector<Int32> mirror', runObservableVectorMirrorTest.bind(pThis)),
+        new TestScenario('IObservableMap<Int32> mirror', runObservableMapMirrorTest.bind(pThis)),
+        new TestScenario('Observable collection mirrors changed from a background thread',
+            runBackgroundMirrorTest.bind(pThis)),
 
         // IVectors that wrap arrays
         new TestScenario('Array as IVector<Boolean>', runBoolArrayAsVectorTest.bind(pThis)),
@@ -150,8 +154,17 @@ export function makeCollectionsTestScenarios(pThis) {
         // Vectors behave like arrays
         new TestScenario('IVector behaves like Array', runVectorAsArrayTest.bind(pThis)),
         new TestScenario('IVectorView behaves like Array', runVectorViewAsArrayTest.bind(pThis)),
+        new TestScenario('Large IVector behaves like Array', runLargeVectorAsArrayTest.bind(pThis)),
         new TestScenario('IMap with string keys behaves like JS object', runIMapAsJSObjectTest.bind(pThis)),
         new TestScenario('IMapView with string keys behaves like readonly JS object', runIMapViewAsReadonlyJSObject.bind(pThis)),
+
+        // Bulk copies of collections
+        new TestScenario('IVector/IVectorView toArray', runVectorToArrayTest.bind(pThis)),
+        new TestScenario('IMap/IMapView toArray/toObject/toMap', runMapSnapshotTest.bind(pThis)),
+
+        // JS objects and Maps as IMap/IMapView
+        new TestScenario('Object as IMapView<String, Int32>', runObjectAsMapViewTest.bind(pThis)),
+        new TestScenario('Object as IMap<String, Int32>', runObjectAsMapTest.bind(pThis)),
     ];
 }
 
@@ -426,6 +439,90 @@ function runObservableVectorTest(scenario) {
     });
 }
 
+function runObservableVectorMirrorTest(scenario) {
+    this.runSync(scenario, () => {
+        var vector = TestComponent.Test.makeObservableVector();
+        vector.replaceAll([0, 1, 2, 3, 4]);
+
+        var mirror = vector.mirror();
+        assert.isTrue(Array.isArray(mirror));
+        assert.equal([0, 1, 2, 3, 4], mirror);
+
+        // NOTE: Changes made on the JS thread are applied to the mirror before the change returns
+        vector.append(5);
+        assert.equal([0, 1, 2, 3, 4, 5], mirror);
+
+        vector.setAt(2, 42);
+        assert.equal([0, 1, 42, 3, 4, 5], mirror);
+
+        vector.removeAt(1);
+        assert.equal([0, 42, 3, 4, 5], mirror);
+
+        vector.insertAt(0, 8);
+        assert.equal([8, 0, 42, 3, 4, 5], mirror);
+
+        vector.replaceAll([7, 8]);
+        assert.equal([7, 8], mirror);
+
+        vector.clear();
+        assert.equal([], mirror);
+    });
+}
+
+function runObservableMapMirrorTest(scenario) {
+    this.runSync(scenario, () => {
+        var map = TestComponent.Test.makeObservableMap();
+        map.insert('foo', 0);
+        map.insert('bar', 1);
+
+        var mirror = map.mirror();
+        assert.equal({ foo: 0, bar: 1 }, mirror);
+
+        map.insert('baz', 2);
+        assert.equal({ foo: 0, bar: 1, baz: 2 }, mirror);
+
+        map.insert('foo', 42);
+        assert.equal({ foo: 42, bar: 1, baz: 2 }, mirror);
+
+        map.remove('bar');
+        assert.equal({ foo: 42, baz: 2 }, mirror);
+
+        map.clear();
+        assert.equal({}, mirror);
+    });
+}
+
+function runBackgroundMirrorTest(scenario) {
+    this.runAsync(scenario, (resolve, reject) => {
+        var vector = TestComponent.Test.makeObservableVector();
+        vector.replaceAll([0, 1, 2, 3, 4]);
+        var vectorMirror = vector.mirror();
+
+        var map = TestComponent.Test.makeObservableMap();
+        map.insert('foo', 0);
+        map.insert('bar', 1);
+        var mapMirror = map.mirror();
+
+        // NOTE: Changes made on other threads are applied asynchronously, but in order and ahead of the completion of
+        // the operation that made them
+        TestComponent.Test.changeObservableVectorFromBackgroundAsync(vector)
+            .then(() => {
+                assert.equal([8, 0, 42, 3, 4, 5], vectorMirror);
+                return TestComponent.Test.changeObservableMapFromBackgroundAsync(map);
+            })
+            .then(() => {
+                assert.equal({ foo: 42, baz: 2 }, mapMirror);
+
+                // The mirrors remain in sync with changes made on the JS thread afterwards
+                vector.append(7);
+                map.insert('bar', 7);
+                assert.equal([8, 0, 42, 3, 4, 5, 7], vectorMirror);
+                assert.equal({ foo: 42, baz: 2, bar: 7 }, mapMirror);
+                resolve();
+            }).catch(reject);
+    });
+}
+
 function runObservableMapTest(scenario) {
     this.runSync(scenario, () => {
         var map = TestComponent.Test.makeObservableMap();
@@ -1401,6 +1498,36 @@ function doVectorSpliceTest() {
     verifyVectorContents(vector, expected);
 }
 
+function runLargeVectorAsArrayTest(scenario) {
+    this.runSync(scenario, () => {
+        // NOTE: Large enough that the vector is read in multiple chunks
+        var contents = Array.from({ length: 2500 }, (_, i) => i);
+        var vector = TestComponent.Test.copyNumericsToVector(contents);
+        var view = TestComponent.Test.copyNumericsToVectorView(contents);
+
+        for (var vec of [vector, view]) {
+            assert.equal(contents.length, vec.length);
+            assert.equal(contents[2499], vec[2499]);
+            assert.equal(undefined, vec[2500]);
+
+            assert.equal(contents.map(x => x * 2), vec.map(x => x * 2));
+            assert.equal(contents.filter(x => (x % 7) == 0), vec.filter(x => (x % 7) == 0));
+            assert.equal(contents.slice(1000, 2100), vec.slice(1000, 2100));
+            assert.equal(contents, vec.concat([]));
+            assert.equal(contents.reduce((a, b) => a + b), vec.reduce((a, b) => a + b));
+            assert.equal(contents.reduceRight((a, b) => a + ',' + b), vec.reduceRight((a, b) => a + ',' + b));
+            assert.equal(1500, vec.lastIndexOf(1500));
+            assert.equal(-1, vec.lastIndexOf(1500, 1499));
+            assert.isTrue(vec.every((x, i) => x == i));
+            assert.isTrue(vec.some(x => x == 2499));
+
+            var visited = [];
+            vec.forEach((x, i) => visited.push(i));
+            assert.equal(contents, visited);
+        }
+    });
+}
+
 function runVectorAsArrayTest(scenario) {
     this.runSync(scenario, () => {
         doCommonVectorAsArrayTest(TestComponent.Test.copyNumericsToVector);
@@ -1552,6 +1679,16 @@ function runIMapAsJSObjectTest(scenario) {
         assert.equal(map["world"], 2);
         assert.equal(map.lookup("world"), 2);
         assert.equal(map.size, 2);
+        assert.undefined(map["missing"]);
+
+        // Repeated accesses of the same keys observe changes made in between
+        for (var i = 0; i < 20; ++i) {
+            map["key" + (i % 4)] = i;
+            assert.equal(map["key" + (i % 4)], i);
+            assert.equal(map["hello"], 1);
+        }
+        map.remove("key0");
+        assert.undefined(map["key0"]);
 
         map.clear();
         assert.equal(map.size, 0);
@@ -1578,3 +1715,95 @@ function runIMapViewAsReadonlyJSObject(scenario) {
         assert.equal(mapView.size, 2);
     });
 }
+
+function runVectorToArrayTest(scenario) {
+    this.runSync(scenario, () => {
+        var contents = Array.from({ length: 2500 }, (_, i) => i);
+        for (var vec of [TestComponent.Test.copyNumericsToVector(contents), TestComponent.Test.copyNumericsToVectorView(contents)]) {
+            var arr = vec.toArray();
+            assert.isTrue(Array.isArray(arr));
+            assert.equal(contents, arr);
+        }
+
+        var strings = TestComponent.Test.copyStringsToVectorView(stringVectorContents).toArray();
+        assert.equal(stringVectorContents, strings);
+
+        assert.equal([], TestComponent.Test.copyNumericsToVector([]).toArray());
+    });
+}
+
+function runMapSnapshotTest(scenario) {
+    this.runSync(scenario, () => {
+        const map = TestComponent.Test.createStringToNumberMap();
+        map.insert("hello", 1);
+        map.insert("world", 2);
+
+        for (var m of [map, TestComponent.Test.copyToMapView(map)]) {
+            var entries = m.toArray();
+            entries.sort((a, b) => a[1] - b[1]);
+            assert.equal([["hello", 1], ["world", 2]], entries);
+
+            assert.equal({ hello: 1, world: 2 }, m.toObject());
+
+            var jsMap = m.toMap();
+            assert.isTrue(jsMap instanceof Map);
+            assert.equal(2, jsMap.size);
+            assert.equal(1, jsMap.get("hello"));
+            assert.equal(2, jsMap.get("world"));
+        }
+
+        map.clear();
+        assert.equal({}, map.toObject());
+        assert.equal(0, map.toMap().size);
+    });
+}
+
+function runObjectAsMapViewTest(scenario) {
+    this.runSync(scenario, () => {
+        // Small objects are copied
+        const obj = { foo: 1, bar: 2, baz: 3 };
+        assert.equal(obj, TestComponent.Test.copyMapViewToMap(obj).toObject());
+        assert.equal(obj, TestComponent.Test.copyMapViewToMap(new Map(Object.entries(obj))).toObject());
+        assert.equal({}, TestComponent.Test.copyMapViewToMap({}).toObject());
+
+        // Large objects are wrapped
+        const large = {};
+        for (var i = 0; i < 1000; ++i) {
+            large['key' + i] = i;
+        }
+        assert.equal(large, TestComponent.Test.copyMapViewToMap(large).toObject());
+        assert.equal(large, TestComponent.Test.copyMapViewToMap(new Map(Object.entries(large))).toObject());
+
+        assert.throwsError(() => TestComponent.Test.copyMapViewToMap({ foo: 'bar' }));
+    });
+}
+
+function runObjectAsMapTest(scenario) {
+    this.runSync(scenario, () => {
+        // Maps wrap the object, so changes made by the callee are visible to the caller
+        const obj = { foo: 1 };
+        TestComponent.Test.insertIntoMap(obj, 'bar', 2);
+        assert.equal({ foo: 1, bar: 2 }, obj);
+
+        const map = new Map([['foo', 1]]);
+        TestComponent.Test.insertIntoMap(map, 'bar', 2);
+        assert.equal(2, map.size);
+        assert.equal(2, map.get('bar'));
+
+        const view = TestComponent.Test.copyToMapView(obj);
+        assert.equal(2, view.size);
+        assert.equal(1, view.lookup('foo'));
+        assert.isTrue(view.hasKey('bar'));
+        assert.isTrue(!view.hasKey('toString'));
+        assert.equal({ foo: 1, bar: 2 }, view.toObject());
+
+        // Only own properties are entries of the map; inherited enumerable properties are neither looked up nor counted
+        const derived = Object.create({ inherited: 42 });
+        derived.foo = 1;
+        const derivedView = TestComponent.Test.copyToMapView(derived);
+        assert.equal(1, derivedView.size);
+        assert.isTrue(!derivedView.hasKey('inherited'));
+        assert.equal({ foo: 1 }, derivedView.toObject());
+        assert.equal({ foo: 1 }, TestComponent.Test.copyMapViewToMap(derived).toObject());
+    });
+}
@@ -28,6 +28,8 @@ export function makeDelegateAndEventTestScenarios(pThis) {
 
         // Async Event Callbacks
         new TestScenario('Async Event Handling', runAsyncEventHandler.bind(pThis)),
+        new TestScenario('Async Event Delivery', runAsyncEventDelivery.bind(pThis)),
+        new TestScenario('Throttled Event Delivery', runThrottledEventDelivery.bind(pThis)),
 
         // Static Delegates
         new TestScenario('Test::StaticInvokeBoolDelegate', runStaticBoolDelegate.bind(pThis)),
@@ -169,6 +171,88 @@ function runAsyncEventHandler(scenario) {
     });
 }
 
+// Raises the event from a background thread and resolves with the handler's arguments along with whether the raising
+// thread had continued without waiting for the handler by the time that the handler ran
+function raiseNumericEventFromBackground(options) {
+    var test = new TestComponent.Test();
+    var handler;
+    var handled = new Promise((resolve) => {
+        handler = (sender, arg) => resolve({ sender: sender, arg: arg, raiseReturned: test.numericEventRaiseReturned() });
+    });
+
+    test.addEventListener('numericeventhandler', handler, options);
+    return Promise.all([test.raiseNumericEventFromBackgroundAsync(42), handled])
+        .then(([_, result]) => {
+            assert.isTrue(result.sender === test);
+            assert.equal(result.arg, 42);
+            return result.raiseReturned;
+        })
+        .finally(() => test.removeEventListener('numericeventhandler', handler));
+}
+
+function runAsyncEventDelivery(scenario) {
+    this.runAsync(scenario, (resolve, reject) => {
+        raiseNumericEventFromBackground({ async: true })
+            .then((raiseReturned) => {
+                assert.isTrue(raiseReturned);
+
+                // By default, the raising thread waits for the handler to complete
+                return raiseNumericEventFromBackground();
+            })
+            .then((raiseReturned) => {
+                assert.isTrue(!raiseReturned);
+                resolve();
+            }).catch(reject);
+    });
+}
+
+function runThrottledEventDelivery(scenario) {
+    this.runAsync(scenario, (resolve, reject) => {
+        var eventValues = [];
+        var handler = (sender, arg) => eventValues.push(arg);
+
+        assert.throwsError(() => TestComponent.Test.addEventListener('staticnumericeventhandler', handler,
+            { async: false, latestOnly: true }));
+        assert.throwsError(() => TestComponent.Test.addEventListener('staticnumericeventhandler', handler,
+            { throttleMs: -1 }));
+
+        // NOTE: The first invocation is never delayed, so it reaches the JS thread ahead of the async completion
+        TestComponent.Test.addEventListener('staticnumericeventhandler', handler, { throttleMs: 1000 });
+        TestComponent.Test.raiseStaticNumericEventAsync(42)
+            .then(() => {
+                assert.equal(eventValues.length, 1);
+                assert.equal(eventValues[0], 42);
+            })
+            .finally(() => TestComponent.Test.removeEventListener('staticnumericeventhandler', handler))
+            .then(() => raiseNumericEventBurstFromBackground({ latestOnly: true }, 0))
+            .then(() => raiseNumericEventBurstFromBackground({ throttleMs: 200 }, 200))
+            .then(resolve).catch(reject);
+    });
+}
+
+// Raises a burst of events from a background thread and checks that superseded invocations were dropped, i.e. that
+// fewer invocations than events reached the handler and that the last of them was for the last event raised. 'delayMs'
+// is how long the final invocation may be held back after the burst completes
+function raiseNumericEventBurstFromBackground(options, delayMs) {
+    const count = 1000;
+    var test = new TestComponent.Test();
+    var eventValues = [];
+    var handler = (sender, arg) => eventValues.push(arg);
+
+    test.addEventListener('numericeventhandler', handler, options);
+    return test.raiseNumericEventBurstFromBackgroundAsync(count)
+        .then(() => new Promise((resolve) => setTimeout(resolve, delayMs + 100)))
+        .then(() => {
+            assert.isTrue(eventValues.length > 0);
+            assert.isTrue(eventValues.length < count);
+            assert.equal(eventValues[eventValues.length - 1], count);
+            for (var i = 1; i < eventValues.length; ++i) {
+                assert.isTrue(eventValues[i - 1] < eventValues[i]);
+            }
+        })
+        .finally(() => test.removeEventListener('numericeventhandler', handler));
+}
+
 function runStaticObjectEventHandlerForNonActivableClass(scenario) {
     var vals = TestValues.s32.valid.map(val => new TestComponent.TestObject(val));
     testStaticEventHandler.call(this, scenario, vals, 'objecteventhandler', (arg) => TestComponent.StaticOnlyTest.raiseObjectEvent(arg), true);
@@ -0,0 +1,107 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @format
+ */
+
+import {
+    TestScenario,
+    assert,
+} from './TestCommon'
+import { testOptions } from './TestOptions'
+
+// NOTE: Most of these scenarios check behavior that only exists with 'projectionMode: "prototype"', hence they check
+// less when run with other configurations
+const isPrototypeMode = testOptions.projectionMode === 'prototype';
+
+export function makeProjectionTestScenarios(pThis) {
+    return [
+        new TestScenario('Methods are shared by all instances', runSharedMethodsTest.bind(pThis)),
+        new TestScenario('Methods resolve the object from this', runMethodThisTest.bind(pThis)),
+        new TestScenario('Properties are accessors on the prototype', runPrototypeAccessorsTest.bind(pThis)),
+        new TestScenario('Objects hold the WinRT object as their native state', runNativeStateTest.bind(pThis)),
+    ];
+}
+
+function runSharedMethodsTest(scenario) {
+    this.runSync(scenario, () => {
+        const test = new TestComponent.Test();
+        assert.isTrue(test.or === this.test.or);
+        assert.isTrue(test.addEventListener === this.test.addEventListener);
+        if (isPrototypeMode) {
+            const proto = Object.getPrototypeOf(test);
+            assert.isTrue(proto === Object.getPrototypeOf(this.test));
+            assert.isTrue(proto !== Object.prototype);
+            assert.isTrue(test.or === proto.or);
+        }
+    });
+}
+
+function runMethodThisTest(scenario) {
+    this.runSync(scenario, () => {
+        const or = this.test.or;
+        assert.equal(or.call(this.test, false, true), true);
+        assert.throwsError(() => or.call({}, false, true), 'Error', "TypeError: 'this' is not a WinRT object");
+        assert.throwsError(() => or.call(undefined, false, true), 'Error', "TypeError: 'this' is not a WinRT object");
+        if (isPrototypeMode) {
+            // Objects that share the prototype, but that weren't created by the projection, have no WinRT object
+            const obj = Object.create(Object.getPrototypeOf(this.test));
+            assert.throwsError(() => obj.or(false, true), 'Error', "TypeError: 'this' is not a WinRT object");
+        }
+    });
+}
+
+function runPrototypeAccessorsTest(scenario) {
+    this.runSync(scenario, () => {
+        const test = new TestComponent.Test();
+        test.boolProperty = true;
+        assert.equal(test.boolProperty, true);
+        test.boolProperty = false;
+        assert.equal(test.boolProperty, false);
+
+        if (isPrototypeMode) {
+            assert.equal(Object.getOwnPropertyNames(test).length, 0);
+
+            const proto = Object.getPrototypeOf(test);
+            const desc = Object.getOwnPropertyDescriptor(proto, 'boolProperty');
+            assert.equal(typeof desc.get, 'function');
+            assert.equal(typeof desc.set, 'function');
+            assert.isTrue(desc.enumerable);
+
+            // The accessors are shared by all instances and resolve the object from 'this'
+            desc.set.call(test, true);
+            assert.equal(desc.get.call(test), true);
+            assert.equal(desc.get.call(this.test), this.test.boolProperty);
+
+            const readOnlyDesc = Object.getOwnPropertyDescriptor(proto, 'propertyValueCppType');
+            assert.equal(typeof readOnlyDesc.get, 'function');
+            assert.undefined(readOnlyDesc.set);
+
+            let names = [];
+            for (var name in test) {
+                names.push(name);
+            }
+            assert.isTrue(names.includes('boolProperty'));
+            assert.isTrue(names.includes('or'));
+        }
+    });
+}
+
+function runNativeStateTest(scenario) {
+    this.runSync(scenario, () => {
+        const test = new TestComponent.Test();
+        const obj = new TestComponent.TestObject(42);
+        test.objectProperty = obj;
+        assert.isTrue(test.objectProperty === obj);
+        assert.equal(test.objectProperty.value, 42);
+        assert.equal(test.objectOutParam(obj).doubledValue.value, 84);
+
+        if (isPrototypeMode) {
+            const copy = Object.create(Object.getPrototypeOf(obj));
+            assert.throwsError(() => copy.value, 'Error', "TypeError: 'this' is not a WinRT object");
+            assert.throwsError(() => { test.objectProperty = copy; });
+            assert.isTrue(test.objectProperty === obj);
+        }
+    });
+}
@@ -0,0 +1,23 @@
+// Copyright (c) Microsoft Corporation.
+// Licensed under the MIT License.
+
+/**
+ * @format
+ */
+
+// The options that the projection gets initialized with. Some scenarios cover behavior that depends on these options,
+// so the tests get run once per configuration. The configuration is selected by 'TestArtifacts/selectTestOptions.ps1'.
+// NOTE: Imports are hoisted, so this needs to be imported before './WinRTTurboModule'
+export const testConfigurations = {
+    default: {},
+    prototype: { projectionMode: 'prototype' },
+    typedArrays: { typedArrays: true },
+    arrayBuffers: { buffersAsArrayBuffers: true },
+    progressThrottle: { progressThrottleMs: 1000 },
+};
+
+export const testConfiguration = 'default';
+
+export const testOptions = testConfigurations[testConfiguration];
+
+global.__rnwinrtOptions = testOptions;
@@ -5,7 +5,9 @@ import * as TurboModuleRegistry from 'react-native/Libraries/TurboModule/TurboMo
 
 module = TurboModuleRegistry.get('WinRTTurboModule');
 if (module) {
-    module.initialize();
+    // Options can be provided by setting 'global.__rnwinrtOptions' before this module is imported, e.g.
+    // '{ projectionMode: "prototype", typedArrays: true }'
+    module.initialize(global.__rnwinrtOptions);
 } else {
     class Test {
         _pass = 0;
@@ -6,6 +6,7 @@
  */
 
 import {AppRegistry} from 'react-native';
+import './TestOptions';
 import './WinRTTurboModule';
 import App from './App';
 import {name as appName} from './app.json';
@@ -3,12 +3,15 @@
 
 #include "pch.h"
 
+#include <algorithm>
 #include <atomic>
 #include <concurrent_vector.h>
 #include <cwctype>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <numeric>
+#include <winrt/Windows.Storage.Streams.h>
 #include <winrt/Windows.Storage.h>
 
 #include "Test.h"
@@ -447,6 +450,16 @@ namespace winrt::TestComponent::implementation
         return hstring(result);
     }
 
+    com_array<int32_t> Test::StaticReverseNumericArray(array_view<int32_t const> values)
+    {
+        return com_array<int32_t>(values.rbegin(), values.rend());
+    }
+
+    com_array<uint8_t> Test::StaticCopyByteArray(array_view<uint8_t const> values)
+    {
+        return com_array<uint8_t>(values.begin(), values.end());
+    }
+
     hstring Test::StaticArityOverload()
     {
         return L"No-arg overload";
@@ -1398,6 +1411,27 @@ namespace winrt::TestComponent::implementation
         return winrt::single_threaded_observable_map<hstring, int32_t>();
     }
 
+    IAsyncAction Test::ChangeObservableVectorFromBackgroundAsync(IObservableVector<int32_t> vector)
+    {
+        co_await winrt::resume_background();
+
+        // E.g. [0, 1, 2, 3, 4] -> [8, 0, 42, 3, 4, 5]
+        vector.Append(5);
+        vector.SetAt(2, 42);
+        vector.RemoveAt(1);
+        vector.InsertAt(0, 8);
+    }
+
+    IAsyncAction Test::ChangeObservableMapFromBackgroundAsync(IObservableMap<hstring, int32_t> map)
+    {
+        co_await winrt::resume_background();
+
+        // E.g. { foo: 0, bar: 1 } -> { foo: 42, baz: 2 }
+        map.Insert(L"baz", 2);
+        map.Insert(L"foo", 42);
+        map.Remove(L"bar");
+    }
+
     IVector<bool> Test::ReturnSameBoolVector(IVector<bool> const& vector)
     {
         return vector;
@@ -1573,6 +1607,16 @@ namespace winrt::TestComponent::implementation
         co_return result - 1; // Because of the ending '++'
     }
 
+    IAsyncActionWithProgress<int32_t> Test::ReportProgressBurstAsync(int32_t count)
+    {
+        co_await winrt::resume_background();
+        auto progress = co_await winrt::get_progress_token();
+        for (int32_t i = 1; i <= count; ++i)
+        {
+            progress(i);
+        }
+    }
+
     IAsyncAction Test::ThrowAsyncException()
     {
         co_await winrt::resume_background();
@@ -1585,6 +1629,74 @@ namespace winrt::TestComponent::implementation
         co_return value;
     }
 
+    IAsyncOperation<Windows::Storage::Streams::IInputStream> Test::CreateInputStreamAsync(uint32_t length)
+    {
+        co_await winrt::resume_background();
+
+        Windows::Storage::Streams::Buffer buffer(length);
+        buffer.Length(length);
+        std::iota(buffer.data(), buffer.data() + length, static_cast<uint8_t>(0));
+
+        Windows::Storage::Streams::InMemoryRandomAccessStream stream;
+        co_await stream.WriteAsync(buffer);
+        co_return stream.GetInputStreamAt(0);
+    }
+
+    // A stream whose 'ReadAsync' throws instead of returning an operation that reports the error
+    struct FailingInputStream :
+        winrt::implements<FailingInputStream, Windows::Storage::Streams::IInputStream, Windows::Foundation::IClosable>
+    {
+        IAsyncOperationWithProgress<Windows::Storage::Streams::IBuffer, uint32_t> ReadAsync(
+            Windows::Storage::Streams::IBuffer const&, uint32_t, Windows::Storage::Streams::InputStreamOptions)
+        {
+            throw hresult_access_denied();
+        }
+
+        void Close()
+        {
+        }
+    };
+
+    Windows::Storage::Streams::IInputStream Test::CreateFailingInputStream()
+    {
+        return winrt::make<FailingInputStream>();
+    }
+
+    // A stream whose reads have already completed by the time 'ReadAsync' returns, so completion handlers get invoked
+    // synchronously when they're set. Produces the same data as 'CreateInputStreamAsync'
+    struct SynchronousInputStream :
+        winrt::implements<SynchronousInputStream, Windows::Storage::Streams::IInputStream,
+            Windows::Foundation::IClosable>
+    {
+        SynchronousInputStream(uint32_t length) : m_remaining(length)
+        {
+        }
+
+        IAsyncOperationWithProgress<Windows::Storage::Streams::IBuffer, uint32_t> ReadAsync(
+            Windows::Storage::Streams::IBuffer buffer, uint32_t count, Windows::Storage::Streams::InputStreamOptions)
+        {
+            // NOTE: Never suspends
+            auto length = std::min({ count, buffer.Capacity(), m_remaining });
+            std::generate(buffer.data(), buffer.data() + length, [&] { return static_cast<uint8_t>(m_position++); });
+            buffer.Length(length);
+            m_remaining -= length;
+            co_return buffer;
+        }
+
+        void Close()
+        {
+        }
+
+    private:
+        uint32_t m_remaining;
+        uint32_t m_position = 0;
+    };
+
+    Windows::Storage::Streams::IInputStream Test::CreateSynchronousInputStream(uint32_t length)
+    {
+        return winrt::make<SynchronousInputStream>(length);
+    }
+
     IAsyncOperation<IVectorView<ITestInterface>> Test::GetObjectsAsync()
     {
         std::vector<ITestInterface> result;
@@ -2757,6 +2869,20 @@ namespace winrt::TestComponent::implementation
         return resultSize;
     }
 
+    Windows::Storage::Streams::IBuffer Test::CreateBuffer(uint32_t length)
+    {
+        Windows::Storage::Streams::Buffer result(length);
+        result.Length(length);
+        std::iota(result.data(), result.data() + length, static_cast<uint8_t>(0));
+        return result;
+    }
+
+    void Test::FillBuffer(Windows::Storage::Streams::IBuffer const& buffer)
+    {
+        buffer.Length(buffer.Capacity());
+        std::iota(buffer.data(), buffer.data() + buffer.Length(), static_cast<uint8_t>(0));
+    }
+
     winrt::event_token Test::BoolEventHandler(TypedEventHandler<TestComponent::Test, bool> const& handler)
     {
         return m_boolEventSource.add(handler);
@@ -2894,18 +3020,51 @@ namespace winrt::TestComponent::implementation
         m_objectEventSource(*this, value);
     }
 
+    IAsyncAction Test::RaiseNumericEventFromBackgroundAsync(int32_t value)
+    {
+        auto strongThis = get_strong();
+        co_await winrt::resume_background();
+
+        ::ResetEvent(m_numericEventRaised.get());
+        m_numericEventSource(*this, value);
+        ::SetEvent(m_numericEventRaised.get());
+    }
+
+    bool Test::NumericEventRaiseReturned()
+    {
+        // NOTE: A handler that is invoked asynchronously can still run before the raising thread signals, hence the
+        // wait. A handler that is invoked synchronously blocks the raising thread, so the wait times out
+        return ::WaitForSingleObject(m_numericEventRaised.get(), 1000) == WAIT_OBJECT_0;
+    }
+
+    IAsyncAction Test::RaiseNumericEventBurstFromBackgroundAsync(int32_t count)
+    {
+        auto strongThis = get_strong();
+        co_await winrt::resume_background();
+
+        for (int32_t i = 1; i <= count; ++i)
+        {
+            m_numericEventSource(*this, i);
+        }
+    }
+
     IMap<winrt::hstring, int32_t> Test::CreateStringToNumberMap()
     {
         return single_threaded_map<winrt::hstring, int32_t>();
     }
 
     template <typename K, typename V>
-    struct MapViewImpl : winrt::implements<MapViewImpl<K, V>, IMapView<K, V>>
+    struct MapViewImpl : winrt::implements<MapViewImpl<K, V>, IMapView<K, V>, IIterable<IKeyValuePair<K, V>>>
     {
         MapViewImpl(IMap<K, V> value) : m_value(std::move(value))
         {
         }
 
+        IIterator<IKeyValuePair<K, V>> First()
+        {
+            return m_value.First();
+        }
+
         uint32_t Size() const noexcept
         {
             return m_value.Size();
@@ -2936,4 +3095,20 @@ namespace winrt::TestComponent::implementation
         return make<MapViewImpl<winrt::hstring, int32_t>>(stringToNumberMap);
     }
 
+    IMap<winrt::hstring, int32_t> Test::CopyMapViewToMap(IMapView<winrt::hstring, int32_t> const& stringToNumberMapView)
+    {
+        std::map<winrt::hstring, int32_t> values;
+        for (auto&& pair : stringToNumberMapView)
+        {
+            values.emplace(pair.Key(), pair.Value());
+        }
+
+        return single_threaded_map<winrt::hstring, int32_t>(std::move(values));
+    }
+
+    void Test::InsertIntoMap(IMap<winrt::hstring, int32_t> const& stringToNumberMap, hstring const& key, int32_t value)
+    {
+        stringToNumberMap.Insert(key, value);
+    }
+
 }
@@ -121,6 +121,8 @@ namespace winrt::TestComponent::implementation
         static int32_t StaticAddAll(array_view<int32_t const> values);
         static hstring StaticAppend(hstring const& a, char16_t b, hstring const& c);
         static hstring StaticAppendAll(array_view<hstring const> values);
+        static com_array<int32_t> StaticReverseNumericArray(array_view<int32_t const> values);
+        static com_array<uint8_t> StaticCopyByteArray(array_view<uint8_t const> values);
 
         static hstring StaticArityOverload();
         static hstring StaticArityOverload(hstring const& str);
@@ -320,6 +322,10 @@ namespace winrt::TestComponent::implementation
 
         static Windows::Foundation::Collections::IObservableVector<int32_t> MakeObservableVector();
         static Windows::Foundation::Collections::IObservableMap<hstring, int32_t> MakeObservableMap();
+        static Windows::Foundation::IAsyncAction ChangeObservableVectorFromBackgroundAsync(
+            Windows::Foundation::Collections::IObservableVector<int32_t> vector);
+        static Windows::Foundation::IAsyncAction ChangeObservableMapFromBackgroundAsync(
+            Windows::Foundation::Collections::IObservableMap<hstring, int32_t> map);
 
         static Windows::Foundation::Collections::IVector<bool> ReturnSameBoolVector(
             Windows::Foundation::Collections::IVector<bool> const& vector);
@@ -384,8 +390,13 @@ namespace winrt::TestComponent::implementation
         static Windows::Foundation::IAsyncActionWithProgress<int32_t> CountToNumberAsync(int32_t value);
         static Windows::Foundation::IAsyncOperation<int32_t> AddAsync(int32_t lhs, int32_t rhs);
         static Windows::Foundation::IAsyncOperationWithProgress<int32_t, int32_t> CountDoubleAsync(int32_t value);
+        static Windows::Foundation::IAsyncActionWithProgress<int32_t> ReportProgressBurstAsync(int32_t count);
         static Windows::Foundation::IAsyncAction ThrowAsyncException();
         static Windows::Foundation::IAsyncOperation<int32_t> ImmediateReturnAsync(int32_t value);
+        static Windows::Foundation::IAsyncOperation<Windows::Storage::Streams::IInputStream> CreateInputStreamAsync(
+            uint32_t length);
+        static Windows::Storage::Streams::IInputStream CreateFailingInputStream();
+        static Windows::Storage::Streams::IInputStream CreateSynchronousInputStream(uint32_t length);
         static Windows::Foundation::IAsyncOperation<
             Windows::Foundation::Collections::IVectorView<TestComponent::ITestInterface>>
         GetObjectsAsync();
@@ -550,6 +561,9 @@ namespace winrt::TestComponent::implementation
         uint32_t InterwovenParams(bool inBool, bool& outBool, int32_t inNumeric, int32_t& outNumeric,
             array_view<int32_t const> inArray, com_array<int32_t>& outArray, array_view<int32_t> refArray);
 
+        Windows::Storage::Streams::IBuffer CreateBuffer(uint32_t length);
+        void FillBuffer(Windows::Storage::Streams::IBuffer const& buffer);
+
         winrt::event_token BoolEventHandler(
             Windows::Foundation::TypedEventHandler<TestComponent::Test, bool> const& handler);
         void BoolEventHandler(winrt::event_token const& token) noexcept;
@@ -588,11 +602,19 @@ namespace winrt::TestComponent::implementation
         void RaiseCompositeStructEvent(CompositeType const& value);
         void RaiseRefEvent(Windows::Foundation::IReference<int32_t> const& value);
         void RaiseObjectEvent(TestComponent::TestObject const& value);
+        Windows::Foundation::IAsyncAction RaiseNumericEventFromBackgroundAsync(int32_t value);
+        bool NumericEventRaiseReturned();
+        Windows::Foundation::IAsyncAction RaiseNumericEventBurstFromBackgroundAsync(int32_t count);
 
         // IMap
         static Windows::Foundation::Collections::IMap<winrt::hstring, int32_t> CreateStringToNumberMap();
         static Windows::Foundation::Collections::IMapView<winrt::hstring, int32_t> CopyToMapView(
             Windows::Foundation::Collections::IMap<winrt::hstring, int32_t> const& stringToNumberMap);
+        static Windows::Foundation::Collections::IMap<winrt::hstring, int32_t> CopyMapViewToMap(
+            Windows::Foundation::Collections::IMapView<winrt::hstring, int32_t> const& stringToNumberMapView);
+        static void InsertIntoMap(
+            Windows::Foundation::Collections::IMap<winrt::hstring, int32_t> const& stringToNumberMap,
+            hstring const& key, int32_t value);
 
     private:
         // Static properties
@@ -693,6 +715,9 @@ namespace winrt::TestComponent::implementation
             m_refEventSource;
         event<Windows::Foundation::TypedEventHandler<TestComponent::Test, TestComponent::TestObject>>
             m_objectEventSource;
+
+        // Signaled once 'RaiseNumericEventFromBackgroundAsync' has returned from raising the event
+        handle m_numericEventRaised{ check_pointer(::CreateEventW(nullptr, true, false, nullptr)) };
     };
 }
 namespace winrt::TestComponent::factory_implementation
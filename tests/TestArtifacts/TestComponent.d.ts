@@ -267,6 +267,8 @@ declare namespace TestComponent {
         public refFillParam(values: number[] | null): void;
         public objectFillParam(values: TestComponent.TestObject[]): void;
         public interwovenParams(inBool: boolean, inNumeric: number, inArray: number[], refArray: number[]): { outBool: boolean; outNumeric: number; outArray: number[]; returnValue: number };
+        public createBuffer(length: number): any;
+        public fillBuffer(buffer: any): void;
         public raiseBoolEvent(value: boolean): void;
         public raiseCharEvent(value: string): void;
         public raiseNumericEvent(value: number): void;
@@ -276,6 +278,9 @@ declare namespace TestComponent {
         public raiseCompositeStructEvent(value: TestComponent.CompositeType): void;
         public raiseRefEvent(value: number | null): void;
         public raiseObjectEvent(value: TestComponent.TestObject): void;
+        public raiseNumericEventFromBackgroundAsync(value: number): Windows.Foundation.WinRTPromise<void, void>;
+        public numericEventRaiseReturned(): boolean;
+        public raiseNumericEventBurstFromBackgroundAsync(count: number): Windows.Foundation.WinRTPromise<void, void>;
         public contractArityOverload(str: string): string;
         private testComponent.ITest2.ContractDefaultOverloadV1(str: string, val: number): string;
         public contractDefaultOverloadV2(str: string, val: boolean): string;
@@ -301,6 +306,8 @@ declare namespace TestComponent {
         public static staticAddAll(values: number[]): number;
         public static staticAppend(a: string, b: string, c: string): string;
         public static staticAppendAll(values: string[]): string;
+        public static staticReverseNumericArray(values: number[]): number[];
+        public static staticCopyByteArray(values: number[]): number[];
         public static staticArityOverload(): string;
         public static staticArityOverload(str: string): string;
         public static staticArityOverload(first: string, second: string): string;
@@ -405,6 +412,8 @@ declare namespace TestComponent {
         public static copyObjectsToVectorView(values: any): Windows.Foundation.Collections.IVectorView<any>;
         public static makeObservableVector(): Windows.Foundation.Collections.IObservableVector<number>;
         public static makeObservableMap(): Windows.Foundation.Collections.IObservableMap<string, number>;
+        public static changeObservableVectorFromBackgroundAsync(vector: Windows.Foundation.Collections.IObservableVector<number>): Windows.Foundation.WinRTPromise<void, void>;
+        public static changeObservableMapFromBackgroundAsync(map: Windows.Foundation.Collections.IObservableMap<string, number>): Windows.Foundation.WinRTPromise<void, void>;
         public static returnSameBoolVector(vector: Windows.Foundation.Collections.IVector<boolean>): Windows.Foundation.Collections.IVector<boolean>;
         public static returnSameCharVector(vector: Windows.Foundation.Collections.IVector<string>): Windows.Foundation.Collections.IVector<string>;
         public static returnSameNumericVector(vector: Windows.Foundation.Collections.IVector<number>): Windows.Foundation.Collections.IVector<number>;
@@ -434,12 +443,18 @@ declare namespace TestComponent {
         public static returnSameObjectIterable(iterable: Windows.Foundation.Collections.IIterable<TestComponent.TestObject>): Windows.Foundation.Collections.IIterable<TestComponent.TestObject>;
         public static createStringToNumberMap(): Windows.Foundation.Collections.IMap<string, number>;
         public static copyToMapView(stringToNumberMap: Windows.Foundation.Collections.IMap<string, number>): Windows.Foundation.Collections.IMapView<string, number>;
+        public static copyMapViewToMap(stringToNumberMapView: Windows.Foundation.Collections.IMapView<string, number>): Windows.Foundation.Collections.IMap<string, number>;
+        public static insertIntoMap(stringToNumberMap: Windows.Foundation.Collections.IMap<string, number>, key: string, value: number): void;
         public static pauseAsync(milliseconds: number): Windows.Foundation.WinRTPromise<void, void>;
         public static countToNumberAsync(value: number): Windows.Foundation.WinRTPromise<void, number>;
         public static addAsync(lhs: number, rhs: number): Windows.Foundation.WinRTPromise<number, void>;
         public static countDoubleAsync(value: number): Windows.Foundation.WinRTPromise<number, number>;
+        public static reportProgressBurstAsync(count: number): Windows.Foundation.WinRTPromise<void, number>;
         public static throwAsyncException(): Windows.Foundation.WinRTPromise<void, void>;
         public static immediateReturnAsync(value: number): Windows.Foundation.WinRTPromise<number, void>;
+        public static createInputStreamAsync(length: number): Windows.Foundation.WinRTPromise<any, void>;
+        public static createFailingInputStream(): any;
+        public static createSynchronousInputStream(length: number): any;
         public static getObjectsAsync(): Windows.Foundation.WinRTPromise<Windows.Foundation.Collections.IVectorView<TestComponent.ITestInterface>, void>;
         public addEventListener(type: "booleventhandler", listener: Windows.Foundation.TypedEventHandler<TestComponent.Test, boolean>): void;
         public removeEventListener(type: "booleventhandler", listener: Windows.Foundation.TypedEventHandler<TestComponent.Test, boolean>): void;
@@ -10,6 +10,7 @@ declare namespace Windows.Foundation.Collections {
 
     interface IIterable<T> {
         first(): Windows.Foundation.Collections.IIterator<T>;
+        toArray(): T extends Windows.Foundation.Collections.IKeyValuePair<infer K, infer V> ? [K, V][] : T[];
     }
 
     interface IIterator<T> {
@@ -35,6 +36,8 @@ declare namespace Windows.Foundation.Collections {
         hasKey(key: K): boolean;
         split(): { first: Windows.Foundation.Collections.IMapView<K, V>; second: Windows.Foundation.Collections.IMapView<K, V> };
         readonly [key: string]: any;
+        toObject(): { [key: string]: V };
+        toMap(): Map<K, V>;
     }
 
     interface IMap<K, V> extends Windows.Foundation.Collections.IIterable<Windows.Foundation.Collections.IKeyValuePair<K, V>> {
@@ -46,16 +49,20 @@ declare namespace Windows.Foundation.Collections {
         remove(key: K): void;
         clear(): void;
         [key: string]: any;
+        toObject(): { [key: string]: V };
+        toMap(): Map<K, V>;
     }
 
     interface IObservableMap<K, V> extends Windows.Foundation.Collections.IMap<K, V> {
         addEventListener(type: "mapchanged", listener: Windows.Foundation.Collections.MapChangedEventHandler<K, V>): void;
         removeEventListener(type: "mapchanged", listener: Windows.Foundation.Collections.MapChangedEventHandler<K, V>): void;
+        mirror(): { [key: string]: V };
     }
 
     interface IObservableVector<T> extends Windows.Foundation.Collections.IVector<T> {
         addEventListener(type: "vectorchanged", listener: Windows.Foundation.Collections.VectorChangedEventHandler<T>): void;
         removeEventListener(type: "vectorchanged", listener: Windows.Foundation.Collections.VectorChangedEventHandler<T>): void;
+        mirror(): T[];
     }
 
     interface IPropertySet extends Windows.Foundation.Collections.IObservableMap<string, any>, Windows.Foundation.Collections.IMap<string, any>, Windows.Foundation.Collections.IIterable<Windows.Foundation.Collections.IKeyValuePair<string, any>> {
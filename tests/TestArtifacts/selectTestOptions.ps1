@@ -0,0 +1,5 @@
+param([Parameter(Mandatory=$true)][string]$configuration)
+
+$path = "$PSScriptRoot\..\RnWinRTTests\TestOptions.js"
+(Get-Content $path) -replace "^export const testConfiguration = '.*';$", "export const testConfiguration = '$configuration';" |
+    Set-Content $path